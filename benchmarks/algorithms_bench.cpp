@@ -0,0 +1,67 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+#include "mattsep/random/algorithms.hpp"
+#include "mattsep/random/engines.hpp"
+
+namespace {
+  namespace random = mattsep::random;
+
+  using engine_type = random::default_random_engine;
+
+  // Shuffles an array of n words per iteration; the rates are per element shuffled.
+  template <class Shuffle>
+  auto add_shuffle(std::string const& name, std::size_t n, Shuffle shuffle) -> void {
+    const auto full_name = name + "/" + std::to_string(n);
+    benchmark::RegisterBenchmark(full_name.c_str(), [n, shuffle](benchmark::State& state) {
+      auto values = std::vector<std::uint64_t>(n);
+      std::iota(values.begin(), values.end(), std::uint64_t{0});
+      auto engine = engine_type{};
+
+      for (auto _ : state) {
+        shuffle(values, engine);
+        benchmark::DoNotOptimize(values.data());
+        benchmark::ClobberMemory();
+      }
+
+      const auto items = static_cast<std::int64_t>(state.iterations()) *
+                         static_cast<std::int64_t>(n);
+      state.SetItemsProcessed(items);
+      state.counters["time_per_value"] = benchmark::Counter(
+          static_cast<double>(items), benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+    });
+  }
+
+  auto add_sample(std::size_t n, std::size_t k) -> void {
+    const auto name = "sample/" + std::to_string(n) + "/" + std::to_string(k);
+    bench::add<std::uint64_t>(name, [values = std::vector<std::uint64_t>(n), k,
+                                     engine = engine_type{}](auto out) mutable {
+      for (std::size_t i = 0; i + k <= out.size(); i += k) {
+        random::sample(values, k, out.begin() + static_cast<std::ptrdiff_t>(i), engine);
+      }
+    });
+  }
+
+  const auto registered = [] {
+    // Sizes across the batch bands of internal::bounded_countdown, and one far beyond the cache.
+    for (auto bits : {10, 12, 16, 17, 24}) {
+      const auto n = std::size_t{1} << bits;
+      add_shuffle("shuffle", n, [](auto& values, auto& engine) {
+        random::shuffle(values, engine);
+      });
+      add_shuffle("std::shuffle", n, [](auto& values, auto& engine) {
+        std::shuffle(values.begin(), values.end(), engine);
+      });
+    }
+
+    add_sample(1 << 16, 16);
+    add_sample(1 << 10, 256);
+    return true;
+  }();
+}  // namespace
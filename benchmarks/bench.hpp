@@ -0,0 +1,56 @@
+#ifndef MATTSEP_RANDOM_BENCHMARKS_BENCH_HPP_INCLUDED
+#define MATTSEP_RANDOM_BENCHMARKS_BENCH_HPP_INCLUDED
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+
+namespace bench {
+
+// Values are produced a block at a time so that scalar and bulk paths do the same amount of work
+// per iteration and the buffer stays in L1.
+inline constexpr std::size_t block_size = 4096;
+
+/**
+ * @brief Times @a fill writing `block_size` values of type T, reporting throughput per value.
+ *
+ * Besides the usual time per iteration, the results carry `items_per_second`, `bytes_per_second`
+ * and `time_per_value` (in seconds).
+ */
+template <class T, class Fill>
+auto measure(benchmark::State& state, Fill& fill) -> void {
+  auto buffer = std::make_unique<T[]>(block_size);
+  const auto out = std::span<T>{buffer.get(), block_size};
+
+  for (auto _ : state) {
+    fill(out);
+    benchmark::DoNotOptimize(buffer.get());
+    benchmark::ClobberMemory();
+  }
+
+  const auto values = static_cast<std::int64_t>(state.iterations()) *
+                      static_cast<std::int64_t>(block_size);
+  state.SetItemsProcessed(values);
+  state.SetBytesProcessed(values * static_cast<std::int64_t>(sizeof(T)));
+  state.counters["time_per_value"] = benchmark::Counter(
+      static_cast<double>(values), benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+/**
+ * @brief Registers a benchmark named @a name that fills blocks of T with @a fill.
+ */
+template <class T, class Fill>
+auto add(std::string const& name, Fill fill) -> void {
+  benchmark::RegisterBenchmark(name.c_str(), [fill](benchmark::State& state) mutable {
+    measure<T>(state, fill);
+  });
+}
+
+}  // namespace bench
+
+#endif
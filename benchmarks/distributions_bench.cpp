@@ -0,0 +1,134 @@
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <ranges>
+#include <span>
+#include <string>
+
+#include "bench.hpp"
+#include "mattsep/random/distributions.hpp"
+#include "mattsep/random/engines.hpp"
+#include "mattsep/random/internal.hpp"
+#include "mattsep/random/views.hpp"
+
+namespace {
+  namespace random = mattsep::random;
+  namespace distributions = mattsep::random::distributions;
+
+  using engine_type = random::default_random_engine;
+
+  /**
+   * @brief Registers one draw per value and, for distributions with one, the batched path.
+   */
+  template <class Engine = engine_type, class Distribution>
+  auto add_distribution(std::string const& name, Distribution dist) -> void {
+    using result_type = typename Distribution::result_type;
+
+    bench::add<result_type>(
+        name + "/scalar", [engine = Engine{}, dist](std::span<result_type> out) mutable {
+          for (auto& x : out) { x = dist(engine); }
+        });
+
+    if constexpr (requires(Engine& g, std::span<result_type> out) { dist.generate(g, out); }) {
+      bench::add<result_type>(name + "/bulk",
+                              [engine = Engine{}, dist](std::span<result_type> out) mutable {
+                                dist.generate(engine, out);
+                              });
+    }
+  }
+
+  /**
+   * @brief Registers copying values out of a `random::view`, to compare with the bulk path.
+   */
+  template <class Distribution>
+  auto add_view(std::string const& name, Distribution dist) -> void {
+    using result_type = typename Distribution::result_type;
+
+    bench::add<result_type>(name + "/view",
+                            [engine = engine_type{}, dist](std::span<result_type> out) mutable {
+                              auto values = random::view(engine, dist) |
+                                            std::views::take(out.size());
+                              std::ranges::copy(values, out.begin());
+                            });
+  }
+
+  const auto registered = [] {
+    constexpr auto u32_max = std::numeric_limits<std::uint32_t>::max();
+    constexpr auto u64_max = std::numeric_limits<std::uint64_t>::max();
+
+    // integer ranges: tiny, small, large, and just over half the type, where Lemire's method
+    // rejects almost half of all draws
+    add_distribution("uniform<int>[1,6]", distributions::uniform<int>{1, 6});
+    add_distribution("uniform<int>[0,999]", distributions::uniform<int>{0, 999});
+    add_distribution("uniform_fixed<int,1,6>", distributions::uniform_fixed<int, 1, 6>{});
+    add_distribution("uniform_fixed<int,0,51>", distributions::uniform_fixed<int, 0, 51>{});
+    add_distribution("uniform_fixed<int,0,1023>", distributions::uniform_fixed<int, 0, 1023>{});
+    add_distribution("uniform<int>[0,2^20)", distributions::uniform<int>{0, (1 << 20) - 1});
+    add_distribution("uniform<uint32>[0,2^31]",
+                     distributions::uniform<std::uint32_t>{0, 1u << 31});
+    add_distribution("uniform<uint32>full", distributions::uniform<std::uint32_t>{0, u32_max});
+    add_distribution("uniform<uint64>[0,2^32]",
+                     distributions::uniform<std::uint64_t>{0, std::uint64_t{1} << 32});
+    add_distribution("uniform<uint64>[0,2^63]",
+                     distributions::uniform<std::uint64_t>{0, std::uint64_t{1} << 63});
+    add_distribution("uniform<uint64>full", distributions::uniform<std::uint64_t>{0, u64_max});
+
+    add_distribution("uniform<float>", distributions::uniform<float>{});
+    add_distribution("uniform<double>", distributions::uniform<double>{});
+    add_distribution("uniform<double>[-1,3)", distributions::uniform<double>{-1.0, 3.0});
+    add_distribution("uniform_full<float>", distributions::uniform_full<float>{});
+    add_distribution("uniform_full<double>", distributions::uniform_full<double>{});
+
+    add_distribution("uniform<bool>", distributions::uniform<bool>{});
+    add_distribution<random::engines::pooled<engine_type>>("uniform<bool>/pooled",
+                                                           distributions::uniform<bool>{});
+    add_distribution("bernoulli(0.3)", distributions::bernoulli{0.3});
+    add_distribution<random::engines::pooled<engine_type>>("bernoulli(0.3)/pooled",
+                                                           distributions::bernoulli{0.3});
+
+    add_distribution("normal<float>", distributions::normal<float>{});
+    add_distribution("normal<double>", distributions::normal<double>{});
+    add_distribution("exponential<float>", distributions::exponential<float>{});
+    add_distribution("exponential<double>", distributions::exponential<double>{});
+    add_distribution("discrete<int>(8)", distributions::discrete<int>{1, 2, 3, 4, 5, 6, 7, 8});
+    add_distribution("binomial<int>(20,0.3)", distributions::binomial<int>{20, 0.3});
+    add_distribution("binomial<int>(10^6,0.3)", distributions::binomial<int>{1'000'000, 0.3});
+    add_distribution("poisson<int>(3.5)", distributions::poisson<int>{3.5});
+    add_distribution("poisson<int>(10^4)", distributions::poisson<int>{1e4});
+
+    add_view("uniform<int>[1,6]", distributions::uniform<int>{1, 6});
+    add_view("uniform<double>", distributions::uniform<double>{});
+    add_view("normal<double>", distributions::normal<double>{});
+
+    // standard library baselines
+    add_distribution<std::mt19937_64>("std::uniform_int_distribution<int>[1,6]",
+                                      std::uniform_int_distribution<int>{1, 6});
+    add_distribution<std::mt19937_64>("std::uniform_int_distribution<uint64>[0,2^63]",
+                                      std::uniform_int_distribution<std::uint64_t>{
+                                          0, std::uint64_t{1} << 63});
+    add_distribution<std::mt19937_64>("std::uniform_real_distribution<float>",
+                                      std::uniform_real_distribution<float>{});
+    add_distribution<std::mt19937_64>("std::uniform_real_distribution<double>",
+                                      std::uniform_real_distribution<double>{});
+    add_distribution<std::mt19937_64>("std::bernoulli_distribution(0.3)",
+                                      std::bernoulli_distribution{0.3});
+    add_distribution<std::mt19937_64>("std::normal_distribution<double>",
+                                      std::normal_distribution<double>{});
+    add_distribution<std::mt19937_64>("std::exponential_distribution<double>",
+                                      std::exponential_distribution<double>{});
+    add_distribution<std::mt19937_64>("std::discrete_distribution<int>(8)",
+                                      std::discrete_distribution<int>{1, 2, 3, 4, 5, 6, 7, 8});
+    add_distribution<std::mt19937_64>("std::binomial_distribution<int>(10^6,0.3)",
+                                      std::binomial_distribution<int>{1'000'000, 0.3});
+    add_distribution<std::mt19937_64>("std::poisson_distribution<int>(10^4)",
+                                      std::poisson_distribution<int>{1e4});
+
+    // the same standard distributions driven by this library's default engine
+    add_distribution("std::uniform_int_distribution<int>[1,6]/jsf64",
+                     std::uniform_int_distribution<int>{1, 6});
+    add_distribution("std::normal_distribution<double>/jsf64",
+                     std::normal_distribution<double>{});
+    return true;
+  }();
+}  // namespace
@@ -0,0 +1,90 @@
+#include <cstdint>
+#include <random>
+#include <span>
+#include <string>
+
+#include "bench.hpp"
+#include "mattsep/random/any_engine.hpp"
+#include "mattsep/random/engines.hpp"
+#include "mattsep/random/internal.hpp"
+#include "mattsep/random/seeding.hpp"
+
+namespace {
+  namespace engines = mattsep::random::engines;
+  namespace internal = mattsep::random::internal;
+
+  /**
+   * @brief Registers one call per value and, for engines with one, the bulk path.
+   */
+  template <class Engine>
+  auto add_engine(std::string const& name) -> void {
+    using result_type = typename Engine::result_type;
+
+    bench::add<result_type>("engine/" + name + "/scalar",
+                            [engine = Engine{}](std::span<result_type> out) mutable {
+                              for (auto& x : out) { x = engine(); }
+                            });
+
+    if constexpr (mattsep::random::bulk_random_bit_generator<Engine>) {
+      bench::add<result_type>("engine/" + name + "/bulk",
+                              [engine = Engine{}](std::span<result_type> out) mutable {
+                                internal::generate(engine, out);
+                              });
+    }
+  }
+
+  /**
+   * @brief Registers seeding a block of engines, one at a time from a single word and all at once
+   * with `seed_many`.
+   */
+  template <class Engine>
+  auto add_seeding(std::string const& name) -> void {
+    using result_type = typename Engine::result_type;
+
+    bench::add<Engine>("seed/" + name + "/single", [](std::span<Engine> out) {
+      for (std::size_t i = 0; i < out.size(); ++i) { out[i].seed(static_cast<result_type>(i)); }
+    });
+    bench::add<Engine>("seed/" + name + "/seed_many",
+                       [](std::span<Engine> out) { mattsep::random::seed_many(out, 42); });
+  }
+
+  const auto registered = [] {
+    add_engine<engines::jsf32>("jsf32");
+    add_engine<engines::jsf64>("jsf64");
+    add_engine<engines::sfc32>("sfc32");
+    add_engine<engines::sfc64>("sfc64");
+    add_engine<engines::jsf32x8>("jsf32x8");
+    add_engine<engines::jsf32x16>("jsf32x16");
+    add_engine<engines::jsf64x4>("jsf64x4");
+    add_engine<engines::jsf64x8>("jsf64x8");
+    add_engine<engines::sfc32x8>("sfc32x8");
+    add_engine<engines::sfc32x16>("sfc32x16");
+    add_engine<engines::sfc64x4>("sfc64x4");
+    add_engine<engines::sfc64x8>("sfc64x8");
+    add_engine<engines::philox4x32>("philox4x32");
+    add_engine<engines::philox4x64>("philox4x64");
+    add_engine<engines::xoshiro256pp>("xoshiro256pp");
+    add_engine<engines::pcg64_dxsm>("pcg64_dxsm");
+    add_engine<engines::wyrand>("wyrand");
+    add_engine<engines::romu_trio>("romu_trio");
+    add_engine<engines::chacha8>("chacha8");
+    add_engine<engines::chacha12>("chacha12");
+    add_engine<engines::chacha20>("chacha20");
+    add_engine<engines::pooled<engines::jsf64>>("pooled<jsf64>");
+    add_engine<mattsep::random::any_engine>("any_engine<jsf64>");
+
+    // The adapter owns a thread and cannot be copied into a lambda.
+    bench::add<std::uint64_t>("engine/background<jsf64>/scalar", [](std::span<std::uint64_t> out) {
+      static auto engine = engines::background<engines::jsf64>{};
+      for (auto& x : out) { x = engine(); }
+    });
+
+    add_seeding<engines::jsf64>("jsf64");
+    add_seeding<engines::sfc64>("sfc64");
+    add_seeding<engines::philox4x64>("philox4x64");
+
+    add_engine<std::mt19937>("std::mt19937");
+    add_engine<std::mt19937_64>("std::mt19937_64");
+    return true;
+  }();
+}  // namespace
@@ -0,0 +1,57 @@
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string>
+
+#include "bench.hpp"
+#include "mattsep/random/engines.hpp"
+#include "mattsep/random/internal.hpp"
+
+namespace {
+  namespace random = mattsep::random;
+  namespace internal = mattsep::random::internal;
+
+  using engine_type = random::default_random_engine;
+
+  template <int K, class Engine = engine_type>
+  auto add_entropy(std::string const& name) -> void {
+    using value_type = internal::uint_least_bits_t<K>;
+    bench::add<value_type>(name, [engine = Engine{}](std::span<value_type> out) mutable {
+      for (auto& x : out) { x = static_cast<value_type>(internal::generate_entropy<K>(engine)); }
+    });
+  }
+
+  template <std::size_t K>
+  auto add_batch(std::uint64_t bound) -> void {
+    const auto name = "bounded_batch<" + std::to_string(K) + ">[0," + std::to_string(bound) + ")";
+    bench::add<std::uint64_t>(name, [engine = engine_type{}, bound](auto out) mutable {
+      auto bounds = std::array<std::uint64_t, K>{};
+      bounds.fill(bound);
+      auto product = std::uint64_t{1};
+      for (auto b : bounds) { product *= b; }
+      const auto threshold = internal::batch_threshold(product);
+
+      for (std::size_t i = 0; i + K <= out.size(); i += K) {
+        internal::bounded_batch(engine, bounds, out.subspan(i, K), threshold);
+      }
+    });
+  }
+
+  const auto registered = [] {
+    add_entropy<1>("generate_entropy<1>");
+    add_entropy<8>("generate_entropy<8>");
+    add_entropy<32>("generate_entropy<32>");
+    add_entropy<64>("generate_entropy<64>");
+    add_entropy<1, random::engines::pooled<engine_type>>("generate_entropy<1>/pooled");
+    add_entropy<8, random::engines::pooled<engine_type>>("generate_entropy<8>/pooled");
+    add_entropy<32, random::engines::jsf32>("generate_entropy<32>/jsf32");
+    add_entropy<64, random::engines::jsf32>("generate_entropy<64>/jsf32");
+
+    add_batch<1>(6);
+    add_batch<8>(6);
+    add_batch<16>(6);
+    add_batch<4>(1000);
+    add_batch<2>(std::uint64_t{1} << 31);
+    return true;
+  }();
+}  // namespace
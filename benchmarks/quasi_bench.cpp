@@ -0,0 +1,42 @@
+#include <cstddef>
+#include <span>
+#include <string>
+
+#include "bench.hpp"
+#include "mattsep/random/engines.hpp"
+#include "mattsep/random/quasi.hpp"
+
+namespace {
+  namespace random = mattsep::random;
+  namespace quasi = random::quasi;
+
+  // Registers a block of points taken one at a time and as one structure-of-arrays batch. The
+  // dimensions divide the block size, so both cover the same points; the rates are per coordinate.
+  template <class Sequence>
+  auto add_sequence(std::string const& name, Sequence sequence) -> void {
+    const auto d = sequence.dimensions();
+    const auto prefix = "quasi/" + name + "/" + std::to_string(d);
+    bench::add<double>(prefix + "/point", [sequence](std::span<double> out) mutable {
+      for (std::size_t i = 0; i < out.size(); i += sequence.dimensions()) {
+        sequence.next(out.subspan(i, sequence.dimensions()));
+      }
+    });
+    bench::add<double>(prefix + "/batch", [sequence](std::span<double> out) mutable {
+      sequence.generate(out);
+    });
+  }
+
+  const auto registered = [] {
+    for (std::size_t d : {4, 16, 256}) {
+      add_sequence("sobol", quasi::sobol{d});
+
+      auto engine = random::default_random_engine{};
+      auto scrambled = quasi::sobol{d};
+      scrambled.scramble(engine);
+      add_sequence("sobol_owen", scrambled);
+
+      add_sequence("halton", quasi::halton{d});
+    }
+    return true;
+  }();
+}  // namespace
@@ -0,0 +1,190 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_ALGORITHMS_SAMPLE_HPP_INCLUDED
+#define MATTSEP_RANDOM_ALGORITHMS_SAMPLE_HPP_INCLUDED
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <unordered_set>
+#include <vector>
+
+#include "mattsep/random/concepts.hpp"
+#include "mattsep/random/distributions/uniform.hpp"
+#include "mattsep/random/internal.hpp"
+
+namespace mattsep::random {
+
+namespace internal {
+
+  /**
+   * @brief Floyd's algorithm: k distinct indices from k draws, whatever the size of the range.
+   *
+   * The indices are sorted before copying, so the output keeps the order of the range.
+   */
+  template <std::ranges::random_access_range R, class O, class G>
+  auto floyd_sample(R&& range, std::uint64_t n, std::uint64_t k, O out, G& g) -> O {
+    // draws[t] is uniform on [0, n - t], the choice for j = n - 1 - t
+    auto draws = std::vector<std::uint64_t>(static_cast<std::size_t>(k));
+    bounded_countdown(g, n, draws);
+
+    auto chosen = std::unordered_set<std::uint64_t>{};
+    chosen.reserve(draws.size());
+    for (auto t = draws.size(); t-- > 0;) {
+      if (!chosen.insert(draws[t]).second) { chosen.insert(n - 1 - t); }
+    }
+
+    auto indices = std::vector<std::uint64_t>(chosen.begin(), chosen.end());
+    std::sort(indices.begin(), indices.end());
+
+    const auto first = std::ranges::begin(range);
+    for (auto i : indices) {
+      *out = first[static_cast<std::ranges::range_difference_t<R>>(i)];
+      ++out;
+    }
+    return out;
+  }
+
+  /**
+   * @brief Knuth's selection sampling: one pass, keeping each element with probability
+   * (still needed) / (still available).
+   */
+  template <std::ranges::forward_range R, class O, class G>
+  auto selection_sample(R&& range, std::uint64_t n, std::uint64_t k, O out, G& g) -> O {
+    constexpr std::size_t block = 64;
+    auto draws = std::array<std::uint64_t, block>{};
+
+    auto it = std::ranges::begin(range);
+    auto seen = std::uint64_t{0};
+    while (k > 0) {
+      const auto count = static_cast<std::size_t>(std::min<std::uint64_t>(block, n - seen));
+      bounded_countdown(g, n - seen, std::span{draws}.first(count));
+      for (std::size_t t = 0; t < count && k > 0; ++t, ++it) {
+        if (draws[t] < k) {
+          *out = *it;
+          ++out;
+          --k;
+        }
+      }
+      seen += count;
+    }
+    return out;
+  }
+
+  /**
+   * @brief Li's Algorithm L: reservoir sampling that skips ahead a geometric number of elements
+   * between replacements, so only O(k log(n / k)) values are drawn.
+   */
+  template <std::ranges::input_range R, std::random_access_iterator O, class G>
+  auto reservoir_sample(R&& range, std::uint64_t k, O out, G& g) -> O {
+    auto it = std::ranges::begin(range);
+    const auto last = std::ranges::end(range);
+
+    auto filled = std::uint64_t{0};
+    for (; filled < k && it != last; ++it, ++filled) {
+      out[static_cast<std::iter_difference_t<O>>(filled)] = *it;
+    }
+    if (it == last) { return out + static_cast<std::iter_difference_t<O>>(filled); }
+
+    auto unit = distributions::uniform<double>{};
+    auto open_unit = [&]() {
+      double u;
+      do { u = unit(g); } while (u == 0.0);
+      return u;
+    };
+
+    const auto inverse_k = 1.0 / static_cast<double>(k);
+    auto w = std::exp(std::log(open_unit()) * inverse_k);
+    while (true) {
+      const auto skip = std::floor(std::log(open_unit()) / std::log1p(-w));
+      const auto limit = static_cast<double>(std::numeric_limits<std::uint64_t>::max());
+      for (auto i = skip < limit ? static_cast<std::uint64_t>(skip) : ~std::uint64_t{0};
+           i > 0 && it != last; --i) {
+        ++it;
+      }
+      if (it == last) { break; }
+
+      const auto slot = distributions::uniform<std::uint64_t>{0, k - 1}(g);
+      out[static_cast<std::iter_difference_t<O>>(slot)] = *it;
+      ++it;
+      w *= std::exp(std::log(open_unit()) * inverse_k);
+    }
+    return out + static_cast<std::iter_difference_t<O>>(k);
+  }
+
+}  // namespace internal
+
+/**
+ * @brief Ratios of range size to sample size above which `sample` uses Floyd's algorithm.
+ */
+inline constexpr std::uint64_t sample_floyd_ratio = 32;
+
+/**
+ * @brief Copies @a k elements of @a range, chosen uniformly without replacement, to @a out.
+ *
+ * The algorithm depends on what is known about the range:
+ * - random access ranges much larger than @a k use Floyd's algorithm, which draws k values;
+ * - other sized forward ranges use selection sampling, a single pass drawing several values per
+ *   engine word;
+ * - ranges of unknown size, such as streams, use reservoir sampling with geometric skips, and
+ *   need a random access output.
+ *
+ * In the first two cases the sample keeps the order of the range. If the range has no more than
+ * @a k elements, all of them are copied.
+ *
+ * @return The end of the output
+ */
+template <std::ranges::input_range R, std::weakly_incrementable O, uniform_random_bit_generator G>
+requires std::indirectly_copyable<std::ranges::iterator_t<R>, O>
+auto sample(R&& range, std::size_t k, O out, G& g) -> O {
+  const auto count = static_cast<std::uint64_t>(k);
+
+  if constexpr (std::ranges::forward_range<R> && std::ranges::sized_range<R>) {
+    const auto n = static_cast<std::uint64_t>(std::ranges::size(range));
+    if (count >= n) { return std::ranges::copy(range, std::move(out)).out; }
+
+    if constexpr (std::ranges::random_access_range<R>) {
+      if (count < n / sample_floyd_ratio) {
+        return internal::floyd_sample(range, n, count, std::move(out), g);
+      }
+    }
+    return internal::selection_sample(range, n, count, std::move(out), g);
+  } else {
+    static_assert(std::random_access_iterator<O>,
+                  "sampling a range of unknown size requires a random access output");
+    if (count == 0) { return out; }
+    return internal::reservoir_sample(range, count, std::move(out), g);
+  }
+}
+
+}  // namespace mattsep::random
+
+#endif
@@ -0,0 +1,122 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_ALGORITHMS_SHUFFLE_HPP_INCLUDED
+#define MATTSEP_RANDOM_ALGORITHMS_SHUFFLE_HPP_INCLUDED
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+#include "mattsep/random/concepts.hpp"
+#include "mattsep/random/internal.hpp"
+
+namespace mattsep::random {
+
+/**
+ * @brief Arrays larger than this many bytes are shuffled with software prefetching.
+ *
+ * Roughly the size of a last-level cache, beyond which each swap would otherwise wait on memory.
+ */
+inline constexpr std::size_t shuffle_prefetch_bytes = std::size_t{1} << 25;
+
+/**
+ * @brief Randomly permutes [@a first, @a last) with a batched Fisher-Yates shuffle.
+ *
+ * The swap indices are drawn through `internal::bounded_countdown`, which packs several of them
+ * into each 64-bit engine word. They are drawn a block ahead of the swaps that use them, so that
+ * for contiguous ranges larger than `shuffle_prefetch_bytes` every swap target can be prefetched
+ * a block in advance. The permutation produced depends only on the engine, not on the iterator
+ * type or on whether prefetching is used.
+ *
+ * @return An iterator equal to @a last
+ */
+template <std::random_access_iterator I, std::sentinel_for<I> S, uniform_random_bit_generator G>
+requires std::permutable<I>
+auto shuffle(I first, S last, G& g) -> I {
+  constexpr std::size_t block = 64;
+
+  const auto n = static_cast<std::uint64_t>(std::ranges::distance(first, last));
+  const auto end = first + static_cast<std::iter_difference_t<I>>(n);
+  if (n < 2) { return end; }
+
+  auto prefetching = false;
+  if constexpr (std::contiguous_iterator<I>) {
+    prefetching = n * sizeof(std::iter_value_t<I>) > shuffle_prefetch_bytes;
+  }
+
+  auto current = std::array<std::uint64_t, block>{};
+  auto upcoming = std::array<std::uint64_t, block>{};
+
+  // Position i - 1 - t is swapped with indices[t], for the i elements not yet placed.
+  auto draw = [&](std::uint64_t i, std::array<std::uint64_t, block>& indices) {
+    const auto count = static_cast<std::size_t>(std::min<std::uint64_t>(block, i - 1));
+    internal::bounded_countdown(g, i, std::span{indices}.first(count));
+    if constexpr (std::contiguous_iterator<I>) {
+      if (prefetching) {
+        for (std::size_t t = 0; t < count; ++t) {
+          internal::prefetch_for_write(std::to_address(first) + indices[t]);
+        }
+      }
+    }
+    return count;
+  };
+
+  auto* indices = &current;
+  auto* next_indices = &upcoming;
+
+  auto i = n;
+  auto count = draw(i, *indices);
+  while (i > 1) {
+    const auto next = i - count;
+    const auto next_count = next > 1 ? draw(next, *next_indices) : 0;
+
+    for (std::size_t t = 0; t < count; ++t) {
+      const auto p = static_cast<std::iter_difference_t<I>>(i - 1 - t);
+      const auto j = static_cast<std::iter_difference_t<I>>((*indices)[t]);
+      std::ranges::iter_swap(first + p, first + j);
+    }
+
+    i = next;
+    count = next_count;
+    std::swap(indices, next_indices);
+  }
+  return end;
+}
+
+template <std::ranges::random_access_range R, uniform_random_bit_generator G>
+requires std::permutable<std::ranges::iterator_t<R>>
+auto shuffle(R&& range, G& g) -> std::ranges::borrowed_iterator_t<R> {
+  return mattsep::random::shuffle(std::ranges::begin(range), std::ranges::end(range), g);
+}
+
+}  // namespace mattsep::random
+
+#endif
@@ -0,0 +1,211 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_ALGORITHMS_WEIGHTED_RESERVOIR_HPP_INCLUDED
+#define MATTSEP_RANDOM_ALGORITHMS_WEIGHTED_RESERVOIR_HPP_INCLUDED
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "mattsep/random/concepts.hpp"
+#include "mattsep/random/distributions/uniform.hpp"
+
+namespace mattsep::random {
+
+/**
+ * @brief A fixed-size weighted sample without replacement of a stream of unknown length.
+ *
+ * This is the A-ExpJ algorithm of Efraimidis and Spirakis. Every item is given the key
+ * u^(1/weight), and the reservoir keeps the items with the largest keys. Instead of drawing a key
+ * for every item, the reservoir draws how much weight to skip before the next item that enters it.
+ * A stream of n items therefore costs O(k log(n / k)) random numbers, and the items skipped over
+ * cost only a subtraction. Keys are stored as logarithms so that small weights do not underflow.
+ *
+ * Reservoirs filled from independent engines, for example one per thread, can be combined with
+ * `merge`. The result is a weighted sample of the concatenated streams.
+ *
+ * @tparam T The type of the items kept
+ */
+template <std::movable T>
+class weighted_reservoir {
+public:
+  using value_type = T;
+
+  explicit weighted_reservoir(std::size_t k) : capacity_{k} {
+    entries_.reserve(k);
+  }
+
+  /**
+   * @brief Offers @a value, with the non-negative weight @a weight, to the reservoir.
+   */
+  template <uniform_random_bit_generator G>
+  auto push(T value, double weight, G& g) -> void {
+    if (!(weight >= 0.0 && weight < std::numeric_limits<double>::infinity())) {
+      throw std::invalid_argument("weighted_reservoir: weights must be finite and non-negative");
+    }
+    ++seen_;
+    if (weight == 0.0 || capacity_ == 0) { return; }
+
+    if (entries_.size() < capacity_) {
+      insert({std::log(open_unit(g)) / weight, std::move(value)});
+      if (entries_.size() == capacity_) { jump(g); }
+      return;
+    }
+
+    skip_ -= weight;
+    if (skip_ > 0.0) { return; }
+
+    // The new key is conditioned to beat the smallest one: u^(1/w) with u in (threshold^w, 1).
+    const auto smallest = entries_.front().log_key;
+    const auto t = std::exp(weight * smallest);
+    const auto log_key = std::log(t + (1.0 - t) * open_unit(g)) / weight;
+    replace_smallest({std::max(log_key, smallest), std::move(value)});
+    jump(g);
+  }
+
+  /**
+   * @brief Offers each element of @a values, weighted by the matching element of @a weights.
+   *
+   * Stops at the end of the shorter range.
+   */
+  template <std::ranges::input_range Values, std::ranges::input_range Weights,
+            uniform_random_bit_generator G>
+  requires std::convertible_to<std::ranges::range_reference_t<Values>, T> &&
+           std::convertible_to<std::ranges::range_reference_t<Weights>, double>
+  auto push(Values&& values, Weights&& weights, G& g) -> void {
+    auto value = std::ranges::begin(values);
+    auto weight = std::ranges::begin(weights);
+    for (; value != std::ranges::end(values) && weight != std::ranges::end(weights);
+         ++value, ++weight) {
+      push(T(*value), static_cast<double>(*weight), g);
+    }
+  }
+
+  /**
+   * @brief Adds the items of @a other, which must have been filled independently of this one.
+   *
+   * The reservoir keeps its own capacity and the items with the largest keys of the two.
+   */
+  template <uniform_random_bit_generator G>
+  auto merge(weighted_reservoir const& other, G& g) -> void {
+    seen_ += other.seen_;
+    if (capacity_ == 0) { return; }
+
+    for (auto const& e : other.entries_) {
+      if (entries_.size() < capacity_) {
+        insert(e);
+      } else if (e.log_key > entries_.front().log_key) {
+        replace_smallest(e);
+      }
+    }
+    // The skip is memoryless, so it can simply be drawn again for the new threshold.
+    if (entries_.size() == capacity_) { jump(g); }
+  }
+
+  /**
+   * @brief Returns the items currently in the reservoir, in no particular order.
+   */
+  [[nodiscard]] auto sample() const -> std::vector<T> {
+    auto out = std::vector<T>{};
+    out.reserve(entries_.size());
+    for (auto const& e : entries_) { out.push_back(e.value); }
+    return out;
+  }
+
+  [[nodiscard]] auto size() const noexcept -> std::size_t {
+    return entries_.size();
+  }
+
+  [[nodiscard]] auto capacity() const noexcept -> std::size_t {
+    return capacity_;
+  }
+
+  /**
+   * @brief Returns the number of items offered so far, including those merged in.
+   */
+  [[nodiscard]] auto seen() const noexcept -> std::uint64_t {
+    return seen_;
+  }
+
+  auto clear() noexcept -> void {
+    entries_.clear();
+    seen_ = 0;
+    skip_ = 0.0;
+  }
+
+private:
+  struct entry {
+    double log_key;
+    T value;
+  };
+
+  std::size_t capacity_;
+  std::vector<entry> entries_ = {};
+  std::uint64_t seen_ = 0;
+  double skip_ = 0.0;
+
+  // The entry with the smallest key is kept at the front.
+  static constexpr auto later = [](entry const& a, entry const& b) {
+    return a.log_key > b.log_key;
+  };
+
+  template <class G>
+  static auto open_unit(G& g) -> double {
+    auto unit = distributions::uniform<double>{};
+    auto u = unit(g);
+    while (u == 0.0) { u = unit(g); }
+    return u;
+  }
+
+  auto insert(entry e) -> void {
+    entries_.push_back(std::move(e));
+    std::ranges::push_heap(entries_, later);
+  }
+
+  auto replace_smallest(entry e) -> void {
+    std::ranges::pop_heap(entries_, later);
+    entries_.back() = std::move(e);
+    std::ranges::push_heap(entries_, later);
+  }
+
+  /**
+   * @brief Draws the total weight to pass over before the next item enters the reservoir.
+   */
+  template <class G>
+  auto jump(G& g) -> void {
+    skip_ = std::log(open_unit(g)) / entries_.front().log_key;
+  }
+};
+
+}  // namespace mattsep::random
+
+#endif
@@ -0,0 +1,214 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_ANY_ENGINE_HPP_INCLUDED
+#define MATTSEP_RANDOM_ANY_ENGINE_HPP_INCLUDED
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+#include "mattsep/random/concepts.hpp"
+#include "mattsep/random/engines.hpp"
+#include "mattsep/random/internal.hpp"
+
+namespace mattsep::random {
+
+/**
+ * @brief An engine whose type is chosen at run time.
+ *
+ * Any `uniform_random_bit_generator` can be held. Its output is read a cache line at a time into a
+ * block of 64-bit words, so the virtual call is made once per refill rather than once per value,
+ * and `generate` hands long spans to the held engine's bulk path in a single call. Engines with
+ * 32-bit or narrower output have it combined into 64-bit words.
+ *
+ * A moved-from `any_engine` holds no engine and may only be assigned to or destroyed.
+ */
+class any_engine {
+public:
+  using result_type = std::uint64_t;
+
+  static constexpr std::size_t block_size = 64 / sizeof(result_type);
+
+  any_engine() : any_engine(default_random_engine{}) {}
+
+  template <uniform_random_bit_generator Engine>
+  requires(!std::same_as<Engine, any_engine>)
+  explicit any_engine(Engine engine)
+      : engine_{std::make_unique<model<Engine>>(std::move(engine))} {}
+
+  any_engine(any_engine const& other)
+      : engine_{other.engine_->clone()}, block_{other.block_}, index_{other.index_} {}
+
+  any_engine(any_engine&&) noexcept = default;
+
+  auto operator=(any_engine const& other) -> any_engine& {
+    if (this != &other) { *this = any_engine{other}; }
+    return *this;
+  }
+
+  auto operator=(any_engine&&) noexcept -> any_engine& = default;
+
+  ~any_engine() = default;
+
+  /**
+   * @brief Returns one of the built-in engines by name, seeded with @a seed.
+   *
+   * The names are "jsf32", "jsf64", "sfc32", "sfc64", "philox4x32", "philox4x64", "xoshiro256pp",
+   * "pcg64_dxsm", "wyrand", "romu_trio", "chacha8", "chacha12" and "chacha20". The 32-bit engines
+   * are seeded with the low 32 bits of @a seed.
+   *
+   * @throws std::invalid_argument for any other name
+   */
+  static auto from_name(std::string_view name, result_type seed) -> any_engine {
+    const auto s32 = static_cast<std::uint32_t>(seed);
+    if (name == "jsf32") { return any_engine{engines::jsf32{s32}}; }
+    if (name == "jsf64") { return any_engine{engines::jsf64{seed}}; }
+    if (name == "sfc32") { return any_engine{engines::sfc32{s32}}; }
+    if (name == "sfc64") { return any_engine{engines::sfc64{seed}}; }
+    if (name == "philox4x32") { return any_engine{engines::philox4x32{s32}}; }
+    if (name == "philox4x64") { return any_engine{engines::philox4x64{seed}}; }
+    if (name == "xoshiro256pp") { return any_engine{engines::xoshiro256pp{seed}}; }
+    if (name == "pcg64_dxsm") { return any_engine{engines::pcg64_dxsm{seed}}; }
+    if (name == "wyrand") { return any_engine{engines::wyrand{seed}}; }
+    if (name == "romu_trio") { return any_engine{engines::romu_trio{seed}}; }
+    if (name == "chacha8") { return any_engine{engines::chacha8{seed}}; }
+    if (name == "chacha12") { return any_engine{engines::chacha12{seed}}; }
+    if (name == "chacha20") { return any_engine{engines::chacha20{seed}}; }
+    throw std::invalid_argument("any_engine: unknown engine '" + std::string{name} + "'");
+  }
+
+  auto operator()() -> result_type {
+    if (index_ == block_size) { refill(); }
+    return block_[index_++];
+  }
+
+  /**
+   * @brief Fills @a out with the next `out.size()` outputs, as repeated calls would.
+   */
+  auto generate(std::span<result_type> out) -> void {
+    const auto buffered = std::min(out.size(), block_size - index_);
+    std::copy_n(block_.begin() + static_cast<std::ptrdiff_t>(index_), buffered, out.begin());
+    index_ += buffered;
+    out = out.subspan(buffered);
+
+    const auto whole = out.size() - out.size() % block_size;
+    if (whole != 0) { engine_->fill(out.first(whole)); }
+    out = out.subspan(whole);
+
+    if (!out.empty()) {
+      refill();
+      std::copy_n(block_.begin(), out.size(), out.begin());
+      index_ = out.size();
+    }
+  }
+
+  auto discard(unsigned long long n) -> void {
+    for (; n > 0; --n) { (*this)(); }
+  }
+
+  /**
+   * @brief Returns the type of the held engine.
+   */
+  [[nodiscard]] auto type() const noexcept -> std::type_info const& {
+    return engine_->type();
+  }
+
+  /**
+   * @brief Returns a pointer to the held engine if it is an @a Engine, and null otherwise.
+   *
+   * Outputs already read into the block are not returned to the held engine, so it may be ahead
+   * of this one by up to `block_size` values.
+   */
+  template <class Engine>
+  [[nodiscard]] auto target() noexcept -> Engine* {
+    if (type() != typeid(Engine)) { return nullptr; }
+    return &static_cast<model<Engine>&>(*engine_).engine;
+  }
+
+  template <class Engine>
+  [[nodiscard]] auto target() const noexcept -> Engine const* {
+    if (type() != typeid(Engine)) { return nullptr; }
+    return &static_cast<model<Engine> const&>(*engine_).engine;
+  }
+
+  static constexpr auto min() -> result_type {
+    return std::numeric_limits<result_type>::min();
+  }
+
+  static constexpr auto max() -> result_type {
+    return std::numeric_limits<result_type>::max();
+  }
+
+private:
+  struct interface {
+    virtual ~interface() = default;
+    virtual auto fill(std::span<result_type> out) -> void = 0;
+    [[nodiscard]] virtual auto clone() const -> std::unique_ptr<interface> = 0;
+    [[nodiscard]] virtual auto type() const noexcept -> std::type_info const& = 0;
+  };
+
+  template <class Engine>
+  struct model final : interface {
+    Engine engine;
+
+    explicit model(Engine e) : engine{std::move(e)} {}
+
+    auto fill(std::span<result_type> out) -> void override {
+      internal::generate_words(engine, out);
+    }
+
+    [[nodiscard]] auto clone() const -> std::unique_ptr<interface> override {
+      return std::make_unique<model>(engine);
+    }
+
+    [[nodiscard]] auto type() const noexcept -> std::type_info const& override {
+      return typeid(Engine);
+    }
+  };
+
+  std::unique_ptr<interface> engine_;
+  alignas(64) std::array<result_type, block_size> block_ = {};
+  std::size_t index_ = block_size;
+
+  auto refill() -> void {
+    engine_->fill(block_);
+    index_ = 0;
+  }
+};
+
+}  // namespace mattsep::random
+
+#endif
@@ -26,6 +26,7 @@
 #define MATTSEP_RANDOM_CONCEPTS_HPP_INCLUDED
 
 #include <concepts>
+#include <span>
 #include <type_traits>
 
 namespace mattsep::random {
@@ -34,13 +35,25 @@ namespace mattsep::random {
 
 template <class G>
 concept uniform_random_bit_generator = requires {
-  std::invocable<G&>;
-  std::unsigned_integral<std::invoke_result_t<G&>>;
+  requires std::invocable<G&>;
+  requires std::unsigned_integral<std::invoke_result_t<G&>>;
   { G::min() } -> std::same_as<std::invoke_result_t<G&>>;
   { G::max() } -> std::same_as<std::invoke_result_t<G&>>;
   std::bool_constant<(G::max() > G::min())>::value;
 };
 
+template <class G>
+concept bulk_random_bit_generator = uniform_random_bit_generator<G> && requires(G& g, std::span<std::invoke_result_t<G&>> out) {
+  g.generate(out);
+};
+
+template <class G>
+concept restorable_random_bit_generator = uniform_random_bit_generator<G> && requires(G const& g, typename G::state_type const& s) {
+  requires std::unsigned_integral<typename G::state_type::value_type>;
+  { g.state() } -> std::same_as<typename G::state_type>;
+  { G::from_state(s) } -> std::same_as<G>;
+};
+
 namespace internal {
   struct uniform_random_bit_generator_archetype {
     using result_type = unsigned int;
@@ -50,10 +63,12 @@ namespace internal {
   };
 
   struct random_number_distribution_archetype {
-    struct param_type {};
+    struct param_type {
+      auto operator==(param_type const&) const -> bool = default;
+    };
 
-    auto min() -> int;
-    auto max() -> int;
+    [[nodiscard]] auto min() const -> int;
+    [[nodiscard]] auto max() const -> int;
 
     [[nodiscard]] auto param() const -> param_type;
     auto param(param_type p) -> void;
@@ -70,14 +85,14 @@ namespace internal {
 
   template <class P>
   concept distribution_parameter = requires {
-    std::copy_constructible<P>;
-    std::equality_comparable<P>;
+    requires std::copy_constructible<P>;
+    requires std::equality_comparable<P>;
     std::is_copy_assignable_v<P>;
   };
 
   template <class Dist, class Result, class Param, class Gen>
   concept random_number_distribution_impl = requires(Dist& d, Dist const& x, Param p, Gen& g) {
-    distribution_parameter<Param>;
+    requires distribution_parameter<Param>;
     std::is_constructible_v<Dist, Param>;
     { d(g) } -> std::same_as<Result>;
     { d(g, p) } -> std::same_as<Result>;
@@ -91,12 +106,12 @@ namespace internal {
 
 template <class D>
 concept random_number_distribution = requires(D d, internal::uniform_random_bit_generator_archetype& g) {
-  std::copy_constructible<D>;
+  requires std::copy_constructible<D>;
   std::is_copy_assignable_v<D>;
   std::is_default_constructible_v<D>;
-  std::invocable<D&, decltype(g)>;
+  requires std::invocable<D&, decltype(g)>;
   { d.param() } -> internal::not_void;
-  internal::random_number_distribution_impl<D, decltype(std::declval<D&>()(g)), decltype(d.param()), decltype(g)>;
+  requires internal::random_number_distribution_impl<D, decltype(std::declval<D&>()(g)), decltype(d.param()), decltype(g)>;
 };
 
 // clang-format on
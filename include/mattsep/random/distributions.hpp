@@ -25,6 +25,12 @@
 #ifndef MATTSEP_RANDOM_DISTRIBUTIONS_HPP_INCLUDED
 #define MATTSEP_RANDOM_DISTRIBUTIONS_HPP_INCLUDED
 
+#include "mattsep/random/distributions/bernoulli.hpp"
+#include "mattsep/random/distributions/binomial.hpp"
+#include "mattsep/random/distributions/discrete.hpp"
+#include "mattsep/random/distributions/exponential.hpp"
+#include "mattsep/random/distributions/normal.hpp"
+#include "mattsep/random/distributions/poisson.hpp"
 #include "mattsep/random/distributions/uniform.hpp"
 
 #endif
\ No newline at end of file
@@ -0,0 +1,178 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_DISTRIBUTIONS_BERNOULLI_HPP_INCLUDED
+#define MATTSEP_RANDOM_DISTRIBUTIONS_BERNOULLI_HPP_INCLUDED
+
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+
+#include "mattsep/random/concepts.hpp"
+#include "mattsep/random/internal.hpp"
+
+namespace mattsep::random::distributions {
+
+/**
+ * @brief Returns `true` with probability `p`, comparing random bits against `p` lazily.
+ *
+ * A draw is the comparison `U < p` for a uniform real `U`, carried out one binary digit at a time
+ * and stopped at the first digit where `U` and `p` differ. Each digit settles the comparison with
+ * probability 1/2, so a draw needs two bits on average and the result is exact for every `double`
+ * `p`. Engines that pool their output (see `engines::pooled`) give up only the bits up to and
+ * including the deciding one; other engines are compared against a whole 64-bit word at once,
+ * which almost always suffices.
+ */
+class bernoulli {
+public:
+  using result_type = bool;
+
+  class param_type {
+  public:
+    constexpr param_type() : param_type(0.5) {}
+
+    constexpr explicit param_type(double p) : p_{p} {
+      if (!(p >= 0.0 && p <= 1.0)) {
+        throw std::invalid_argument("bernoulli: p must be in [0, 1]");
+      }
+
+      // p = M * 2^-S with M an integer; the binary digits of p are `zeros_` zeros followed by
+      // the digits of M, most significant first
+      const auto bits = std::bit_cast<std::uint64_t>(p);
+      const auto exponent = static_cast<int>(bits >> 52);
+      const auto fraction = bits & ((std::uint64_t{1} << 52) - 1);
+      const auto m = exponent == 0 ? fraction : fraction | (std::uint64_t{1} << 52);
+      const auto s = exponent == 0 ? 1074 : 1075 - exponent;
+      if (m != 0 && p < 1.0) {
+        zeros_ = s - (64 - std::countl_zero(m));
+        digits_ = m << std::countl_zero(m);
+        reversed_ = reverse(chunk(0));
+      }
+    }
+
+    [[nodiscard]] constexpr auto p() const noexcept -> double {
+      return p_;
+    }
+
+    constexpr auto operator==(param_type const& rhs) const -> bool {
+      return p_ == rhs.p_;
+    }
+
+  private:
+    friend class bernoulli;
+
+    double p_;
+    int zeros_ = 0;
+    std::uint64_t digits_ = 0;
+    std::uint64_t reversed_ = 0;
+
+    /**
+     * @brief Returns the 64 binary digits of p starting at digit @a offset (0 is the 1/2 digit).
+     */
+    [[nodiscard]] constexpr auto chunk(int offset) const noexcept -> std::uint64_t {
+      const auto shift = offset - zeros_;
+      if (shift <= -64 || shift >= 64) { return 0; }
+      return shift < 0 ? digits_ >> -shift : digits_ << shift;
+    }
+  };
+
+  constexpr bernoulli() = default;
+  constexpr explicit bernoulli(double p) : p_{p} {}
+  constexpr explicit bernoulli(param_type const& p) : p_{p} {}
+
+  [[nodiscard]] constexpr auto p() const noexcept -> double {
+    return p_.p();
+  }
+
+  [[nodiscard]] constexpr auto param() const -> param_type {
+    return p_;
+  }
+
+  constexpr auto param(param_type const& p) -> void {
+    p_ = p;
+  }
+
+  [[nodiscard]] constexpr auto min() const -> result_type {
+    return false;
+  }
+
+  [[nodiscard]] constexpr auto max() const -> result_type {
+    return true;
+  }
+
+  template <uniform_random_bit_generator G>
+  constexpr auto operator()(G& g) -> result_type {
+    return (*this)(g, p_);
+  }
+
+  template <uniform_random_bit_generator G>
+  constexpr auto operator()(G& g, param_type const& p) -> result_type {
+    if (p.p_ >= 1.0) { return true; }
+
+    if constexpr (requires { g.consume(1); }) {
+      // Compare against as many pooled bits as there are. The pool serves its lowest bit first,
+      // so the digits of p are reversed to line up, and the first differing digit is the lowest
+      // set bit of the difference.
+      for (int offset = 0; offset < p.zeros_ + 64;) {
+        const auto u = g.peek();
+        const auto n = g.pooled_bits();
+        const auto q = offset == 0 ? p.reversed_ : reverse(p.chunk(offset));
+        const auto mask = n == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << n) - 1;
+        const auto diff = (u ^ q) & mask;
+        if (diff != 0) {
+          const auto i = std::countr_zero(diff);
+          g.consume(i + 1);
+          return ((q >> i) & 1u) != 0;
+        }
+        g.consume(n);
+        offset += n;
+      }
+      // past the last digit of p, U >= p
+      return false;
+    } else {
+      for (int offset = 0; offset < p.zeros_ + 64; offset += 64) {
+        const auto u = static_cast<std::uint64_t>(internal::generate_entropy<64>(g));
+        const auto q = p.chunk(offset);
+        if (u != q) { return u < q; }
+      }
+      return false;
+    }
+  }
+
+private:
+  param_type p_;
+
+  static constexpr auto reverse(std::uint64_t x) noexcept -> std::uint64_t {
+    x = ((x >> 1) & 0x5555'5555'5555'5555ull) | ((x & 0x5555'5555'5555'5555ull) << 1);
+    x = ((x >> 2) & 0x3333'3333'3333'3333ull) | ((x & 0x3333'3333'3333'3333ull) << 2);
+    x = ((x >> 4) & 0x0F0F'0F0F'0F0F'0F0Full) | ((x & 0x0F0F'0F0F'0F0F'0F0Full) << 4);
+    x = ((x >> 8) & 0x00FF'00FF'00FF'00FFull) | ((x & 0x00FF'00FF'00FF'00FFull) << 8);
+    x = ((x >> 16) & 0x0000'FFFF'0000'FFFFull) | ((x & 0x0000'FFFF'0000'FFFFull) << 16);
+    return (x >> 32) | (x << 32);
+  }
+};
+
+}  // namespace mattsep::random::distributions
+
+#endif
@@ -0,0 +1,195 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_DISTRIBUTIONS_BINOMIAL_HPP_INCLUDED
+#define MATTSEP_RANDOM_DISTRIBUTIONS_BINOMIAL_HPP_INCLUDED
+
+#include <concepts>
+#include <cstdint>
+#include <stdexcept>
+
+#include "mattsep/random/concepts.hpp"
+#include "mattsep/random/distributions/uniform.hpp"
+#include "mattsep/random/internal/inversion.hpp"
+#include "mattsep/random/internal/math.hpp"
+
+namespace mattsep::random::distributions {
+
+/**
+ * @brief The number of successes in `n` independent trials that each succeed with probability `p`.
+ *
+ * Draws are made for min(p, 1 - p) and reflected when p > 1/2. When the mean of that is below 10,
+ * a draw inverts a table of cumulative probabilities; otherwise it uses Hörmann's BTRS transformed
+ * rejection (1993), whose expected cost does not depend on `n`. Either way the setup is done once,
+ * by `param_type`.
+ */
+template <std::integral T = int>
+class binomial {
+public:
+  using result_type = T;
+
+  class param_type {
+  public:
+    constexpr param_type() : param_type(1, 0.5) {}
+
+    constexpr explicit param_type(result_type n, double p = 0.5) : n_{n}, p_{p} {
+      if (n < 0) { throw std::invalid_argument("binomial: n must be non-negative"); }
+      if (!(p >= 0.0 && p <= 1.0)) { throw std::invalid_argument("binomial: p must be in [0, 1]"); }
+
+      namespace math = internal::math;
+
+      flip_ = p > 0.5;
+      const auto r = flip_ ? 1.0 - p : p;
+      const auto q = 1.0 - r;
+      const auto trials = static_cast<double>(n);
+      ratio_ = r / q;
+      trials_ = trials;
+
+      if (r == 0.0 || n == 0) {
+        degenerate_ = true;
+      } else if (trials * r < 10.0) {
+        table_ = internal::inversion_table(math::exp(trials * math::log(q)), ratio());
+      } else {
+        rejection_ = true;
+        const auto spq = math::sqrt(trials * r * q);
+        b_ = 1.15 + 2.53 * spq;
+        a_ = -0.0873 + 0.0248 * b_ + 0.01 * r;
+        c_ = trials * r + 0.5;
+        v_r_ = 0.92 - 4.2 / b_;
+        alpha_ = (2.83 + 5.1 / b_) * spq;
+        log_ratio_ = math::log(ratio_);
+        mode_ = static_cast<double>(static_cast<std::uint64_t>((trials + 1.0) * r));
+        h_ = math::log_factorial(mode_) + math::log_factorial(trials - mode_);
+      }
+    }
+
+    [[nodiscard]] constexpr auto n() const noexcept -> result_type {
+      return n_;
+    }
+
+    [[nodiscard]] constexpr auto p() const noexcept -> double {
+      return p_;
+    }
+
+    constexpr auto operator==(param_type const& rhs) const -> bool {
+      return n_ == rhs.n_ && p_ == rhs.p_;
+    }
+
+  private:
+    friend class binomial;
+
+    result_type n_;
+    double p_;
+    bool flip_ = false;
+    bool degenerate_ = false;
+    bool rejection_ = false;
+    double trials_ = 0.0;
+    double ratio_ = 0.0;  // r / (1 - r), for r = min(p, 1 - p)
+    internal::inversion_table table_ = {};
+    double a_ = 0.0, b_ = 0.0, c_ = 0.0, v_r_ = 0.0, alpha_ = 0.0;
+    double log_ratio_ = 0.0, mode_ = 0.0, h_ = 0.0;
+
+    /**
+     * @brief Returns the function k -> p(k + 1) / p(k).
+     */
+    [[nodiscard]] constexpr auto ratio() const noexcept {
+      return [n = trials_, ratio = ratio_](double k) { return (n - k) / (k + 1.0) * ratio; };
+    }
+  };
+
+  constexpr binomial() = default;
+  constexpr explicit binomial(result_type n, double p = 0.5) : p_{n, p} {}
+  constexpr explicit binomial(param_type const& p) : p_{p} {}
+
+  [[nodiscard]] constexpr auto n() const noexcept -> result_type {
+    return p_.n();
+  }
+
+  [[nodiscard]] constexpr auto p() const noexcept -> double {
+    return p_.p();
+  }
+
+  [[nodiscard]] constexpr auto param() const -> param_type {
+    return p_;
+  }
+
+  constexpr auto param(param_type const& p) -> void {
+    p_ = p;
+  }
+
+  [[nodiscard]] constexpr auto min() const -> result_type {
+    return 0;
+  }
+
+  [[nodiscard]] constexpr auto max() const -> result_type {
+    return p_.n();
+  }
+
+  template <uniform_random_bit_generator G>
+  constexpr auto operator()(G& g) -> result_type {
+    return (*this)(g, p_);
+  }
+
+  template <uniform_random_bit_generator G>
+  constexpr auto operator()(G& g, param_type const& p) -> result_type {
+    const auto k = p.degenerate_ ? 0.0 : p.rejection_ ? btrs(g, p) : invert(g, p);
+    const auto x = static_cast<result_type>(k);
+    return p.flip_ ? static_cast<result_type>(p.n_ - x) : x;
+  }
+
+private:
+  param_type p_;
+
+  template <class G>
+  static constexpr auto invert(G& g, param_type const& p) -> double {
+    const auto u = uniform<double>{}(g);
+    return static_cast<double>(p.table_.find(u, p.ratio()));
+  }
+
+  template <class G>
+  static constexpr auto btrs(G& g, param_type const& p) -> double {
+    namespace math = internal::math;
+
+    auto unit = uniform<double>{};
+    while (true) {
+      const auto u = unit(g) - 0.5;
+      auto v = unit(g);
+      const auto us = 0.5 - (u < 0.0 ? -u : u);
+      const auto x = (2.0 * p.a_ / us + p.b_) * u + p.c_;
+      if (x < 0.0 || x >= p.trials_ + 1.0) { continue; }
+      const auto k = static_cast<double>(static_cast<std::uint64_t>(x));
+
+      if (us >= 0.07 && v <= p.v_r_) { return k; }
+
+      v = math::log(v * p.alpha_ / (p.a_ / (us * us) + p.b_));
+      const auto bound = p.h_ - math::log_factorial(k) - math::log_factorial(p.trials_ - k) +
+                         (k - p.mode_) * p.log_ratio_;
+      if (v <= bound) { return k; }
+    }
+  }
+};
+
+}  // namespace mattsep::random::distributions
+
+#endif
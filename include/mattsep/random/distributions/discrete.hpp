@@ -0,0 +1,222 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_DISTRIBUTIONS_DISCRETE_HPP_INCLUDED
+#define MATTSEP_RANDOM_DISTRIBUTIONS_DISCRETE_HPP_INCLUDED
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "mattsep/random/concepts.hpp"
+#include "mattsep/random/internal.hpp"
+
+namespace mattsep::random::distributions {
+
+/**
+ * @brief A distribution over the indices of a list of weights, sampled with Vose's alias method.
+ *
+ * The table is stored as two parallel arrays: a `float` acceptance probability and a `uint32_t`
+ * alias per bucket. A draw uses a single 64-bit word. Multiplying the word by the bucket count
+ * gives the bucket in the high half of the product (Lemire's method, including its rejection step,
+ * so the bucket is unbiased); the low half is then uniform over the bucket's share of the words,
+ * and its top 24 bits decide between the bucket and its alias.
+ */
+template <std::integral T = int>
+class discrete {
+public:
+  using result_type = T;
+
+  class param_type {
+  public:
+    constexpr param_type() : param_type(std::span<double const>{}) {}
+    constexpr param_type(std::initializer_list<double> weights)
+        : param_type(std::span<double const>{weights.begin(), weights.size()}) {}
+
+    /**
+     * @brief Builds the alias table for @a weights.
+     *
+     * Weights must be non-negative and finite with a positive sum. An empty list is treated as a
+     * single bucket of weight 1.
+     */
+    constexpr explicit param_type(std::span<double const> weights) {
+      build(weights);
+    }
+
+    [[nodiscard]] constexpr auto size() const noexcept -> std::size_t {
+      return prob_.size();
+    }
+
+    /**
+     * @brief Returns the normalized probability of each outcome.
+     */
+    [[nodiscard]] constexpr auto probabilities() const -> std::vector<double> const& {
+      return probabilities_;
+    }
+
+    constexpr auto operator==(param_type const& rhs) const -> bool {
+      return probabilities_ == rhs.probabilities_;
+    }
+
+  private:
+    friend class discrete;
+
+    std::vector<double> probabilities_;
+    std::vector<float> prob_;
+    std::vector<std::uint32_t> alias_;
+    std::uint64_t threshold_ = 0;
+
+    constexpr auto build(std::span<double const> weights) -> void {
+      if (weights.empty()) {
+        probabilities_ = {1.0};
+        prob_ = {1.0f};
+        alias_ = {0};
+        threshold_ = 0;
+        return;
+      }
+
+      if (weights.size() > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::length_error("discrete: too many weights");
+      }
+
+      const auto n = weights.size();
+      auto total = 0.0;
+      for (auto w : weights) {
+        if (!(w >= 0.0 && w <= std::numeric_limits<double>::max())) {
+          throw std::invalid_argument("discrete: weights must be finite and non-negative");
+        }
+        total += w;
+      }
+      if (!(total > 0.0)) { throw std::invalid_argument("discrete: weights must not all be zero"); }
+
+      probabilities_.resize(n);
+      prob_.assign(n, 1.0f);
+      alias_.resize(n);
+      std::iota(alias_.begin(), alias_.end(), std::uint32_t{0});
+
+      // scaled[i] = n * p[i]; buckets below 1 are topped up from buckets above 1
+      auto scaled = std::vector<double>(n);
+      auto small = std::vector<std::uint32_t>{};
+      auto large = std::vector<std::uint32_t>{};
+      for (std::size_t i = 0; i < n; ++i) {
+        probabilities_[i] = weights[i] / total;
+        scaled[i] = probabilities_[i] * static_cast<double>(n);
+        (scaled[i] < 1.0 ? small : large).push_back(static_cast<std::uint32_t>(i));
+      }
+
+      while (!small.empty() && !large.empty()) {
+        const auto s = small.back();
+        const auto l = large.back();
+        small.pop_back();
+
+        prob_[s] = static_cast<float>(scaled[s]);
+        alias_[s] = l;
+
+        scaled[l] = (scaled[l] + scaled[s]) - 1.0;
+        if (scaled[l] < 1.0) {
+          large.pop_back();
+          small.push_back(l);
+        }
+      }
+      // Whatever is left is 1 up to rounding error, and keeps prob = 1 and alias = itself.
+
+      const auto size = static_cast<std::uint64_t>(n);
+      threshold_ = (0 - size) % size;
+    }
+  };
+
+  constexpr discrete() = default;
+  constexpr discrete(std::initializer_list<double> weights) : p_{weights} {}
+  constexpr explicit discrete(std::span<double const> weights) : p_{weights} {}
+  constexpr explicit discrete(param_type p) : p_{std::move(p)} {}
+
+  [[nodiscard]] constexpr auto probabilities() const -> std::vector<double> const& {
+    return p_.probabilities();
+  }
+
+  [[nodiscard]] constexpr auto param() const -> param_type {
+    return p_;
+  }
+
+  constexpr auto param(param_type p) -> void {
+    p_ = std::move(p);
+  }
+
+  [[nodiscard]] constexpr auto min() const -> result_type {
+    return 0;
+  }
+
+  [[nodiscard]] constexpr auto max() const -> result_type {
+    return static_cast<result_type>(p_.size() - 1);
+  }
+
+  template <uniform_random_bit_generator G>
+  constexpr auto operator()(G& g) -> result_type {
+    return sample(g, p_);
+  }
+
+  template <uniform_random_bit_generator G>
+  constexpr auto operator()(G& g, param_type const& p) -> result_type {
+    return sample(g, p);
+  }
+
+  /**
+   * @brief Fills @a out with independent values from the distribution.
+   */
+  template <uniform_random_bit_generator G>
+  constexpr auto generate(G& g, std::span<result_type> out) -> void {
+    for (auto& x : out) { x = sample(g, p_); }
+  }
+
+private:
+  param_type p_;
+
+  template <uniform_random_bit_generator G>
+  static constexpr auto sample(G& g, param_type const& p) -> result_type {
+    const auto n = static_cast<std::uint64_t>(p.prob_.size());
+
+    internal::uint128_t m;
+    std::uint64_t low;
+    do {
+      const auto x = static_cast<std::uint64_t>(internal::generate_entropy<64>(g));
+      m = static_cast<internal::uint128_t>(x) * n;
+      low = static_cast<std::uint64_t>(m);
+    } while (low < p.threshold_);
+
+    const auto i = static_cast<std::size_t>(m >> 64);
+    const auto u = static_cast<float>(low >> 40) * 0x1p-24f;
+    return static_cast<result_type>(u < p.prob_[i] ? i : p.alias_[i]);
+  }
+};
+
+}  // namespace mattsep::random::distributions
+
+#endif
@@ -0,0 +1,127 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_DISTRIBUTIONS_EXPONENTIAL_HPP_INCLUDED
+#define MATTSEP_RANDOM_DISTRIBUTIONS_EXPONENTIAL_HPP_INCLUDED
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+#include "mattsep/random/concepts.hpp"
+#include "mattsep/random/internal.hpp"
+#include "mattsep/random/internal/math.hpp"
+#include "mattsep/random/internal/ziggurat.hpp"
+
+namespace mattsep::random::distributions {
+
+/**
+ * @brief The exponential distribution, sampled with a 256-layer ziggurat.
+ *
+ * Shares its structure with `normal`: the low 8 bits of a 64-bit word pick the layer and the top
+ * 53 bits the position within it, and only the rare wedge and tail cases evaluate the density or
+ * a logarithm.
+ */
+template <std::floating_point T = double>
+class exponential {
+public:
+  using result_type = T;
+  struct param_type {
+    result_type lambda = T{1};
+
+    auto operator==(param_type const&) const -> bool = default;
+  };
+
+  constexpr exponential() = default;
+  constexpr explicit exponential(result_type lambda) : p_{lambda} {}
+  constexpr explicit exponential(param_type const& p) : p_{p} {}
+
+  [[nodiscard]] constexpr auto lambda() const -> result_type {
+    return p_.lambda;
+  }
+
+  [[nodiscard]] constexpr auto param() const -> param_type {
+    return p_;
+  }
+
+  constexpr auto param(param_type const& p) -> void {
+    p_ = p;
+  }
+
+  [[nodiscard]] constexpr auto min() const -> result_type {
+    return T{0};
+  }
+
+  [[nodiscard]] constexpr auto max() const -> result_type {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  template <uniform_random_bit_generator G>
+  constexpr auto operator()(G& g) -> result_type {
+    return (*this)(g, p_);
+  }
+
+  template <uniform_random_bit_generator G>
+  constexpr auto operator()(G& g, param_type const& p) -> result_type {
+    return static_cast<result_type>(standard(g)) * (T{1} / p.lambda);
+  }
+
+  /**
+   * @brief Fills @a out with independent values from the distribution.
+   */
+  template <uniform_random_bit_generator G>
+  constexpr auto generate(G& g, std::span<result_type> out) -> void {
+    const auto scale = T{1} / p_.lambda;
+    for (auto& x : out) { x = static_cast<result_type>(standard(g)) * scale; }
+  }
+
+private:
+  param_type p_;
+
+  template <uniform_random_bit_generator G>
+  static constexpr auto standard(G& g) -> double {
+    namespace zig = internal::ziggurat;
+    constexpr auto const& t = zig::exponential;
+
+    auto entropy = [&]() { return static_cast<std::uint64_t>(internal::generate_entropy<64>(g)); };
+
+    for (;;) {
+      const auto bits = entropy();
+      const auto i = static_cast<std::size_t>(bits & 0xFF);
+      const auto x = zig::unit(bits) * t.x[i];
+
+      if (x < t.x[i + 1]) [[likely]] { return x; }
+      if (i == 0) { return zig::exponential_r - internal::math::log(zig::open_unit(entropy())); }
+      if (t.f[i + 1] + (t.f[i] - t.f[i + 1]) * zig::unit(entropy()) < zig::exponential_pdf(x)) {
+        return x;
+      }
+    }
+  }
+};
+
+}  // namespace mattsep::random::distributions
+
+#endif
@@ -0,0 +1,151 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_DISTRIBUTIONS_NORMAL_HPP_INCLUDED
+#define MATTSEP_RANDOM_DISTRIBUTIONS_NORMAL_HPP_INCLUDED
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+#include "mattsep/random/concepts.hpp"
+#include "mattsep/random/internal.hpp"
+#include "mattsep/random/internal/math.hpp"
+#include "mattsep/random/internal/ziggurat.hpp"
+
+namespace mattsep::random::distributions {
+
+/**
+ * @brief The normal (Gaussian) distribution, sampled with a 256-layer ziggurat.
+ *
+ * Each attempt consumes one 64-bit word: the low 8 bits select a layer and the top 52 bits give a
+ * signed position within it. About 99% of draws are accepted on the first comparison. The tables
+ * are built at compile time and the rare wedge and tail paths use the library's own elementary
+ * functions, so results depend only on the engine and its seed.
+ */
+template <std::floating_point T = double>
+class normal {
+public:
+  using result_type = T;
+  struct param_type {
+    result_type mean = T{0};
+    result_type stddev = T{1};
+
+    auto operator==(param_type const&) const -> bool = default;
+  };
+
+  constexpr normal() = default;
+  constexpr normal(result_type mean, result_type stddev = T{1}) : p_{mean, stddev} {}
+  constexpr explicit normal(param_type const& p) : p_{p} {}
+
+  [[nodiscard]] constexpr auto mean() const -> result_type {
+    return p_.mean;
+  }
+
+  [[nodiscard]] constexpr auto stddev() const -> result_type {
+    return p_.stddev;
+  }
+
+  [[nodiscard]] constexpr auto param() const -> param_type {
+    return p_;
+  }
+
+  constexpr auto param(param_type const& p) -> void {
+    p_ = p;
+  }
+
+  [[nodiscard]] constexpr auto min() const -> result_type {
+    return std::numeric_limits<result_type>::lowest();
+  }
+
+  [[nodiscard]] constexpr auto max() const -> result_type {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  template <uniform_random_bit_generator G>
+  constexpr auto operator()(G& g) -> result_type {
+    return (*this)(g, p_);
+  }
+
+  template <uniform_random_bit_generator G>
+  constexpr auto operator()(G& g, param_type const& p) -> result_type {
+    return p.mean + p.stddev * static_cast<result_type>(standard(g));
+  }
+
+  /**
+   * @brief Fills @a out with independent values from the distribution.
+   */
+  template <uniform_random_bit_generator G>
+  constexpr auto generate(G& g, std::span<result_type> out) -> void {
+    const auto mean = p_.mean;
+    const auto stddev = p_.stddev;
+    for (auto& x : out) { x = mean + stddev * static_cast<result_type>(standard(g)); }
+  }
+
+private:
+  param_type p_;
+
+  template <uniform_random_bit_generator G>
+  static constexpr auto standard(G& g) -> double {
+    namespace zig = internal::ziggurat;
+    constexpr auto const& t = zig::normal;
+
+    for (;;) {
+      const auto bits = static_cast<std::uint64_t>(internal::generate_entropy<64>(g));
+      const auto i = static_cast<std::size_t>(bits & 0xFF);
+      const auto x = zig::signed_unit(bits) * t.x[i];
+
+      if ((x < 0 ? -x : x) < t.x[i + 1]) [[likely]] { return x; }
+      if (i == 0) { return tail(g, x < 0); }
+
+      const auto u = zig::unit(static_cast<std::uint64_t>(internal::generate_entropy<64>(g)));
+      if (t.f[i + 1] + (t.f[i] - t.f[i + 1]) * u < zig::normal_pdf(x)) { return x; }
+    }
+  }
+
+  /**
+   * @brief Samples from the tail beyond the base layer, using Marsaglia's method.
+   */
+  template <uniform_random_bit_generator G>
+  static constexpr auto tail(G& g, bool negative) -> double {
+    namespace zig = internal::ziggurat;
+    auto open_unit = [&]() {
+      return zig::open_unit(static_cast<std::uint64_t>(internal::generate_entropy<64>(g)));
+    };
+
+    double x, y;
+    do {
+      x = internal::math::log(open_unit()) / zig::normal_r;
+      y = internal::math::log(open_unit());
+    } while (-2.0 * y < x * x);
+
+    return negative ? x - zig::normal_r : zig::normal_r - x;
+  }
+};
+
+}  // namespace mattsep::random::distributions
+
+#endif
@@ -0,0 +1,166 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_DISTRIBUTIONS_POISSON_HPP_INCLUDED
+#define MATTSEP_RANDOM_DISTRIBUTIONS_POISSON_HPP_INCLUDED
+
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+#include "mattsep/random/concepts.hpp"
+#include "mattsep/random/distributions/uniform.hpp"
+#include "mattsep/random/internal/inversion.hpp"
+#include "mattsep/random/internal/math.hpp"
+
+namespace mattsep::random::distributions {
+
+/**
+ * @brief The Poisson distribution with the given mean.
+ *
+ * Means below 10 invert a table of cumulative probabilities. Larger means use Hörmann's PTRS
+ * transformed rejection (1993), which accepts about 9 draws in 10 at once and whose expected cost
+ * does not depend on the mean. Either way the setup is done once, by `param_type`.
+ */
+template <std::integral T = int>
+class poisson {
+public:
+  using result_type = T;
+
+  class param_type {
+  public:
+    constexpr param_type() : param_type(1.0) {}
+
+    constexpr explicit param_type(double mean) : mean_{mean} {
+      if (!(mean >= 0.0 && mean < std::numeric_limits<double>::infinity())) {
+        throw std::invalid_argument("poisson: the mean must be finite and non-negative");
+      }
+
+      namespace math = internal::math;
+
+      if (mean == 0.0) {
+        degenerate_ = true;
+      } else if (mean < 10.0) {
+        table_ = internal::inversion_table(math::exp(-mean), ratio());
+      } else {
+        rejection_ = true;
+        const auto root = math::sqrt(mean);
+        b_ = 0.931 + 2.53 * root;
+        a_ = -0.059 + 0.02483 * b_;
+        log_inv_alpha_ = math::log(1.1239 + 1.1328 / (b_ - 3.4));
+        v_r_ = 0.9277 - 3.6224 / (b_ - 2.0);
+        log_mean_ = math::log(mean);
+      }
+    }
+
+    [[nodiscard]] constexpr auto mean() const noexcept -> double {
+      return mean_;
+    }
+
+    constexpr auto operator==(param_type const& rhs) const -> bool {
+      return mean_ == rhs.mean_;
+    }
+
+  private:
+    friend class poisson;
+
+    double mean_;
+    bool degenerate_ = false;
+    bool rejection_ = false;
+    internal::inversion_table table_ = {};
+    double a_ = 0.0, b_ = 0.0, log_inv_alpha_ = 0.0, v_r_ = 0.0, log_mean_ = 0.0;
+
+    /**
+     * @brief Returns the function k -> p(k + 1) / p(k).
+     */
+    [[nodiscard]] constexpr auto ratio() const noexcept {
+      return [mean = mean_](double k) { return mean / (k + 1.0); };
+    }
+  };
+
+  constexpr poisson() = default;
+  constexpr explicit poisson(double mean) : p_{mean} {}
+  constexpr explicit poisson(param_type const& p) : p_{p} {}
+
+  [[nodiscard]] constexpr auto mean() const noexcept -> double {
+    return p_.mean();
+  }
+
+  [[nodiscard]] constexpr auto param() const -> param_type {
+    return p_;
+  }
+
+  constexpr auto param(param_type const& p) -> void {
+    p_ = p;
+  }
+
+  [[nodiscard]] constexpr auto min() const -> result_type {
+    return 0;
+  }
+
+  [[nodiscard]] constexpr auto max() const -> result_type {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  template <uniform_random_bit_generator G>
+  constexpr auto operator()(G& g) -> result_type {
+    return (*this)(g, p_);
+  }
+
+  template <uniform_random_bit_generator G>
+  constexpr auto operator()(G& g, param_type const& p) -> result_type {
+    if (p.degenerate_) { return 0; }
+    if (p.rejection_) { return static_cast<result_type>(ptrs(g, p)); }
+    return static_cast<result_type>(p.table_.find(uniform<double>{}(g), p.ratio()));
+  }
+
+private:
+  param_type p_;
+
+  template <class G>
+  static constexpr auto ptrs(G& g, param_type const& p) -> double {
+    namespace math = internal::math;
+
+    auto unit = uniform<double>{};
+    while (true) {
+      const auto u = unit(g) - 0.5;
+      const auto v = unit(g);
+      const auto us = 0.5 - (u < 0.0 ? -u : u);
+      const auto x = (2.0 * p.a_ / us + p.b_) * u + p.mean_ + 0.43;
+      if (x < 0.0) { continue; }
+      const auto k = static_cast<double>(static_cast<std::uint64_t>(x));
+
+      if (us >= 0.07 && v <= p.v_r_) { return k; }
+      if (us < 0.013 && v > us) { continue; }
+
+      const auto lhs = math::log(v) + p.log_inv_alpha_ - math::log(p.a_ / (us * us) + p.b_);
+      if (lhs <= -p.mean_ + k * p.log_mean_ - math::log_factorial(k)) { return k; }
+    }
+  }
+};
+
+}  // namespace mattsep::random::distributions
+
+#endif
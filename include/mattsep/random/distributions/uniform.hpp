@@ -25,8 +25,15 @@
 #ifndef MATTSEP_RANDOM_DISTRIBUTIONS_UNIFORM_HPP_INCLUDED
 #define MATTSEP_RANDOM_DISTRIBUTIONS_UNIFORM_HPP_INCLUDED
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
 #include <limits>
+#include <span>
 
 #include "mattsep/random/concepts.hpp"
 #include "mattsep/random/internal.hpp"
@@ -43,24 +50,118 @@ public:
   struct param_type {
     result_type min = std::numeric_limits<result_type>::min();
     result_type max = std::numeric_limits<result_type>::max();
+
+    auto operator==(param_type const&) const -> bool = default;
   };
 
-  uniform() = default;
-  uniform(result_type a, result_type b) : p_{a, b} {}
-  uniform(param_type const& p) : p_{p} {}
+  constexpr uniform() = default;
+  constexpr uniform(result_type a, result_type b) : p_{a, b} {}
+  constexpr uniform(param_type const& p) : p_{p} {}
+
+  [[nodiscard]] constexpr auto param() const -> param_type {
+    return p_;
+  }
+
+  constexpr auto param(param_type const& p) -> void {
+    p_ = p;
+  }
+
+  [[nodiscard]] constexpr auto min() const -> result_type {
+    return p_.min;
+  }
+
+  [[nodiscard]] constexpr auto max() const -> result_type {
+    return p_.max;
+  }
 
   template <uniform_random_bit_generator G>
-  auto operator()(G& g) -> result_type {
-    using utype = std::make_unsigned_t<result_type>;
-    constexpr auto bits = std::numeric_limits<result_type>::digits;
-    const auto range = static_cast<utype>(p_.max - p_.min) + 1;
+  constexpr auto operator()(G& g) -> result_type {
+    return (*this)(g, p_);
+  }
+
+  template <uniform_random_bit_generator G>
+  constexpr auto operator()(G& g, param_type const& p) -> result_type {
+    constexpr auto bits = std::numeric_limits<utype>::digits;
+    const auto range = range_of(p);
     if (range == 0) { return static_cast<result_type>(internal::generate_entropy<bits>(g)); }
-    return p_.min + static_cast<result_type>(lemire_bounded(range, g));
+    return offset(p.min, lemire_bounded(range, g));
+  }
+
+  /**
+   * @brief Fills @a out with independent values from the distribution.
+   *
+   * Ranges of up to 2^32 values are served in batches: each 64-bit engine word is split into as
+   * many bounded values as the range allows, at most 16 (e.g. 16 dice rolls, or 6 values below
+   * 1000), with Lemire's batched method, and the rejection threshold is computed once for the
+   * whole call. Larger ranges use one word per value, again with a precomputed threshold. The
+   * output has the same distribution as repeated calls to `operator()`, but not the same values.
+   */
+  template <uniform_random_bit_generator G>
+  constexpr auto generate(G& g, std::span<result_type> out) -> void {
+    constexpr auto bits = std::numeric_limits<utype>::digits;
+    const auto range = static_cast<std::uint64_t>(range_of(p_));
+    const auto min = p_.min;
+
+    if (range == 0) {
+      for (auto& x : out) { x = static_cast<result_type>(internal::generate_entropy<bits>(g)); }
+    } else if (range <= (std::uint64_t{1} << 32)) {
+      // the largest batch whose product of bounds still fits in a 64-bit word
+      constexpr auto word = internal::uint128_t{1} << 64;
+      auto k = std::size_t{1};
+      auto product = internal::uint128_t{range};
+      while (k < max_batch && product * range <= word) {
+        product *= range;
+        ++k;
+      }
+
+      auto bounds = std::array<std::uint64_t, max_batch>{};
+      bounds.fill(range);
+      const auto threshold = internal::batch_threshold(static_cast<std::uint64_t>(product));
+
+      auto values = std::array<std::uint64_t, max_batch>{};
+      const auto batch_bounds = std::span<std::uint64_t const>{bounds}.first(k);
+      const auto batch_values = std::span{values}.first(k);
+      while (!out.empty()) {
+        internal::bounded_batch(g, batch_bounds, batch_values, threshold);
+        const auto count = std::min(k, out.size());
+        for (std::size_t i = 0; i < count; ++i) {
+          out[i] = offset(min, static_cast<utype>(values[i]));
+        }
+        out = out.subspan(count);
+      }
+    } else {
+      const auto threshold = (0 - range) % range;
+      for (auto& x : out) {
+        internal::uint128_t m;
+        do {
+          m = static_cast<internal::uint128_t>(internal::generate_entropy<64>(g)) * range;
+        } while (static_cast<std::uint64_t>(m) < threshold);
+        x = offset(min, static_cast<utype>(m >> 64));
+      }
+    }
   }
 
 private:
+  using utype = std::make_unsigned_t<result_type>;
+
+  static constexpr std::size_t max_batch = 16;
+
   param_type p_;
 
+  /**
+   * @brief Returns the number of values in [p.min, p.max], or 0 if that is the full range of T.
+   */
+  static constexpr auto range_of(param_type const& p) -> utype {
+    return static_cast<utype>(static_cast<utype>(p.max) - static_cast<utype>(p.min) + 1u);
+  }
+
+  /**
+   * @brief Returns `min + x`, computed without signed overflow.
+   */
+  static constexpr auto offset(result_type min, utype x) -> result_type {
+    return static_cast<result_type>(static_cast<utype>(static_cast<utype>(min) + x));
+  }
+
   /**
    * @brief Returns a random unsigned integer from the range [0, @a max).
    *
@@ -75,7 +176,7 @@ private:
    * @return UInt A random unsigned integer in the range [0, max).
    */
   template <std::unsigned_integral UInt, uniform_random_bit_generator G>
-  auto lemire_bounded(UInt max, G& g) -> UInt {
+  constexpr auto lemire_bounded(UInt max, G& g) -> UInt {
     constexpr auto bits = std::numeric_limits<UInt>::digits;
 
     using small_t = UInt;
@@ -97,6 +198,59 @@ private:
   }
 };
 
+/**
+ * @brief A fair coin.
+ *
+ * Each value costs a single bit of entropy, which is only economical with an engine that pools its
+ * leftover bits (see `engines::pooled`). `generate` takes 64 values from each engine word either
+ * way.
+ */
+template <>
+class uniform<bool> {
+public:
+  using result_type = bool;
+  struct param_type {
+    auto operator==(param_type const&) const -> bool = default;
+  };
+
+  constexpr uniform() = default;
+  constexpr uniform(param_type const&) {}
+
+  [[nodiscard]] constexpr auto param() const -> param_type {
+    return {};
+  }
+
+  constexpr auto param(param_type const&) -> void {}
+
+  [[nodiscard]] constexpr auto min() const -> result_type {
+    return false;
+  }
+
+  [[nodiscard]] constexpr auto max() const -> result_type {
+    return true;
+  }
+
+  template <uniform_random_bit_generator G>
+  constexpr auto operator()(G& g) -> result_type {
+    return internal::generate_entropy<1>(g) != 0;
+  }
+
+  template <uniform_random_bit_generator G>
+  constexpr auto operator()(G& g, param_type const&) -> result_type {
+    return (*this)(g);
+  }
+
+  template <uniform_random_bit_generator G>
+  constexpr auto generate(G& g, std::span<result_type> out) -> void {
+    while (!out.empty()) {
+      const auto word = static_cast<std::uint64_t>(internal::generate_entropy<64>(g));
+      const auto count = std::min(out.size(), std::size_t{64});
+      for (std::size_t i = 0; i < count; ++i) { out[i] = ((word >> i) & 1u) != 0; }
+      out = out.subspan(count);
+    }
+  }
+};
+
 template <std::floating_point T>
 class uniform<T> {
 public:
@@ -104,30 +258,331 @@ public:
   struct param_type {
     result_type min = T{0};
     result_type max = T{1};
+
+    auto operator==(param_type const&) const -> bool = default;
   };
 
+  constexpr uniform() = default;
+  constexpr uniform(result_type a, result_type b) : p_{a, b} {}
+  constexpr uniform(param_type const& p) : p_{p} {}
+
+  [[nodiscard]] constexpr auto param() const -> param_type {
+    return p_;
+  }
+
+  constexpr auto param(param_type const& p) -> void {
+    p_ = p;
+  }
+
+  [[nodiscard]] constexpr auto min() const -> result_type {
+    return p_.min;
+  }
+
+  [[nodiscard]] constexpr auto max() const -> result_type {
+    return p_.max;
+  }
+
   template <uniform_random_bit_generator G>
-  auto operator()(G& g) -> result_type {
-    result_type u;
-    do { u = p_.min + (p_.max - p_.min) * unit_real(g); } while (u >= p_.max);
-    return u;
+  constexpr auto operator()(G& g) -> result_type {
+    return (*this)(g, p_);
+  }
+
+  template <uniform_random_bit_generator G>
+  constexpr auto operator()(G& g, param_type const& p) -> result_type {
+    const auto u = unit(static_cast<bits_type>(internal::generate_entropy<word_bits>(g)));
+    return std::min(p.min + (p.max - p.min) * u, below(p.max));
+  }
+
+  /**
+   * @brief Fills @a out with independent values from the distribution.
+   *
+   * Engine output is drawn a block at a time and converted in a loop with no branches, which the
+   * compiler is free to vectorize. Each 64-bit word yields two `float`s or one `double`.
+   */
+  template <uniform_random_bit_generator G>
+  constexpr auto generate(G& g, std::span<result_type> out) -> void {
+    const auto min = p_.min;
+    const auto width = p_.max - p_.min;
+    const auto upper = below(p_.max);
+
+    constexpr auto per_word = std::size_t{64 / word_bits};
+    constexpr auto block_words = std::size_t{64};
+    auto words = std::array<std::uint64_t, block_words>{};
+
+    while (!out.empty()) {
+      const auto count = std::min(block_words * per_word, out.size());
+      internal::generate_words(g, std::span{words}.first((count + per_word - 1) / per_word));
+      for (std::size_t i = 0; i < count; ++i) {
+        const auto bits = words[i / per_word] >> (word_bits * (i % per_word));
+        out[i] = std::min(min + width * unit(static_cast<bits_type>(bits)), upper);
+      }
+      out = out.subspan(count);
+    }
   }
 
 private:
+  static constexpr int word_bits = std::same_as<T, float> ? 32 : 64;
+  using bits_type = internal::uint_least_bits_t<word_bits>;
+
   param_type p_;
 
   /**
    * @brief Returns a random floating-point value in the half-open range [0, 1).
    *
-   * @tparam G The type of @a g
-   * @param g A bit generator
-   * @return result_type A real-valued number in the range [0, 1)
+   * For `float` and `double` the top mantissa-many bits of @a bits are placed below the exponent
+   * of 1, giving a value in [1, 2) from which 1 is subtracted exactly. Other types fall back to
+   * scaling an integer.
    */
+  static constexpr auto unit(bits_type bits) -> T {
+    constexpr auto mantissa = std::numeric_limits<T>::digits - 1;
+    if constexpr (std::same_as<T, float> || std::same_as<T, double>) {
+      constexpr auto one = std::bit_cast<bits_type>(T{1});
+      const auto fraction = static_cast<bits_type>(bits >> (word_bits - mantissa));
+      return std::bit_cast<T>(static_cast<bits_type>(one | fraction)) - T{1};
+    } else {
+      constexpr auto digits = std::min(std::numeric_limits<T>::digits, word_bits);
+      constexpr auto precision = T{1} / static_cast<T>(bits_type{1} << (digits - 1)) / T{2};
+      return static_cast<T>(bits >> (word_bits - digits)) * precision;
+    }
+  }
+
+  /**
+   * @brief Returns the largest representable value less than @a x.
+   *
+   * Results are clamped to this so that rounding in `a + (b - a) * u` can never produce `b`.
+   */
+  static constexpr auto below(T x) -> T {
+    if constexpr (std::same_as<T, float> || std::same_as<T, double>) {
+      if (x == T{0}) { return -std::numeric_limits<T>::denorm_min(); }
+      const auto bits = std::bit_cast<bits_type>(x);
+      return std::bit_cast<T>(static_cast<bits_type>(x > T{0} ? bits - 1 : bits + 1));
+    } else {
+      return std::nextafter(x, -std::numeric_limits<T>::infinity());
+    }
+  }
+};
+
+/**
+ * @brief Produces every representable value in [0, 1) with its exact probability.
+ *
+ * `uniform<T>` returns multiples of the machine epsilon, so values below about 2^-52 are never seen
+ * from `uniform<double>`. This distribution instead draws the binary exponent geometrically (each
+ * halving of the value is one fair coin flip) and the mantissa uniformly, which is what rounding
+ * a real number drawn uniformly from [0, 1) down to the nearest representable value gives,
+ * subnormals included. It costs one 64-bit engine word almost always: `double` needs a second word
+ * with probability 2^-12 and `float` with probability 2^-41.
+ *
+ * @tparam T Either `float` or `double`
+ */
+template <std::floating_point T = double>
+requires std::same_as<T, float> || std::same_as<T, double>
+class uniform_full {
+public:
+  using result_type = T;
+  struct param_type {
+    auto operator==(param_type const&) const -> bool = default;
+  };
+
+  constexpr uniform_full() = default;
+  constexpr uniform_full(param_type const&) {}
+
+  [[nodiscard]] constexpr auto param() const -> param_type {
+    return {};
+  }
+
+  constexpr auto param(param_type const&) -> void {}
+
+  [[nodiscard]] constexpr auto min() const -> result_type {
+    return T{0};
+  }
+
+  [[nodiscard]] constexpr auto max() const -> result_type {
+    return T{1};
+  }
+
   template <uniform_random_bit_generator G>
-  auto unit_real(G& g) -> T {
-    constexpr auto bits = std::numeric_limits<T>::digits;
-    constexpr auto precision = 0.5 * std::numeric_limits<T>::epsilon();
-    return internal::generate_entropy<bits>(g) * precision;
+  constexpr auto operator()(G& g, param_type const&) -> result_type {
+    return (*this)(g);
+  }
+
+  template <uniform_random_bit_generator G>
+  constexpr auto operator()(G& g) -> result_type {
+    using bits_type = internal::uint_least_bits_t<8 * sizeof(T)>;
+
+    constexpr auto mantissa = std::numeric_limits<T>::digits - 1;
+    // the number of halvings from [1/2, 1) to the subnormals
+    constexpr auto max_zeros = std::numeric_limits<T>::max_exponent - 2;
+
+    auto word = static_cast<std::uint64_t>(internal::generate_entropy<64>(g));
+    const auto significand = static_cast<bits_type>(word & ((std::uint64_t{1} << mantissa) - 1));
+
+    // the bits above the mantissa start the run of coin flips
+    auto zeros = std::countl_zero(word >> mantissa) - mantissa;
+    if (zeros == 64 - mantissa) {
+      while (zeros < max_zeros) {
+        word = static_cast<std::uint64_t>(internal::generate_entropy<64>(g));
+        zeros += std::countl_zero(word);
+        if (word != 0) { break; }
+      }
+    }
+
+    const auto exponent = static_cast<bits_type>(max_zeros - std::min(zeros, max_zeros));
+    return std::bit_cast<T>(static_cast<bits_type>((exponent << mantissa) | significand));
+  }
+};
+
+/**
+ * @brief Produces integers uniformly distributed on [Min, Max], a range fixed at compile time.
+ *
+ * The bounds are inclusive, as for `uniform<T>`, so a die is `uniform_fixed<int, 1, 6>`. Since
+ * the range is a constant, the rejection threshold of Lemire's method is too. Ranges that are a
+ * power of two are just the top bits of one draw, and other ranges use a 32-bit multiply where
+ * they fit in 32 bits, drawing only 32 bits of entropy, instead of the double-width multiply of
+ * `uniform<T>`.
+ * `generate` packs several values into each 64-bit engine word, as `uniform<T>` does, with batch
+ * sizes and thresholds also computed at compile time.
+ */
+template <std::integral T, T Min, T Max>
+requires(!std::same_as<T, bool> && Min <= Max)
+class uniform_fixed {
+public:
+  using result_type = T;
+  struct param_type {
+    auto operator==(param_type const&) const -> bool = default;
+  };
+
+  constexpr uniform_fixed() = default;
+  constexpr uniform_fixed(param_type const&) {}
+
+  [[nodiscard]] constexpr auto param() const -> param_type {
+    return {};
+  }
+
+  constexpr auto param(param_type const&) -> void {}
+
+  [[nodiscard]] constexpr auto min() const -> result_type {
+    return Min;
+  }
+
+  [[nodiscard]] constexpr auto max() const -> result_type {
+    return Max;
+  }
+
+  template <uniform_random_bit_generator G>
+  constexpr auto operator()(G& g, param_type const&) -> result_type {
+    return (*this)(g);
+  }
+
+  template <uniform_random_bit_generator G>
+  constexpr auto operator()(G& g) -> result_type {
+    if constexpr (range == 1) {
+      return Min;
+    } else if constexpr (std::has_single_bit(range) || range == 0) {
+      return offset(static_cast<std::uint64_t>(internal::generate_entropy<range_bits>(g)));
+    } else {
+      using word_type = internal::uint_least_bits_t<multiply_bits>;
+      using wide_type = internal::uint_least_bits_t<2 * multiply_bits>;
+      constexpr auto bound = static_cast<word_type>(range);
+      constexpr auto threshold = static_cast<word_type>(static_cast<word_type>(0 - bound) % bound);
+
+      wide_type m;
+      do {
+        const auto x = static_cast<word_type>(internal::generate_entropy<multiply_bits>(g));
+        m = static_cast<wide_type>(x) * bound;
+      } while (static_cast<word_type>(m) < threshold);
+      return offset(static_cast<std::uint64_t>(m >> multiply_bits));
+    }
+  }
+
+  /**
+   * @brief Fills @a out with independent values from the distribution.
+   *
+   * Power-of-two ranges cut each engine word into `64 / log2(range)` fields. Other ranges draw
+   * batches of values from single words with Lemire's batched method, as large as the range allows.
+   */
+  template <uniform_random_bit_generator G>
+  constexpr auto generate(G& g, std::span<result_type> out) -> void {
+    if constexpr (range == 1) {
+      std::ranges::fill(out, Min);
+    } else if constexpr (std::has_single_bit(range) || range == 0) {
+      constexpr auto per_word = std::size_t{64 / range_bits};
+      constexpr auto block_words = std::size_t{64};
+      constexpr auto mask = ~std::uint64_t{0} >> (64 - range_bits);
+      auto words = std::array<std::uint64_t, block_words>{};
+
+      while (!out.empty()) {
+        const auto count = std::min(block_words * per_word, out.size());
+        const auto word_count = (count + per_word - 1) / per_word;
+        internal::generate_words(g, std::span{words}.first(word_count));
+        for (std::size_t w = 0; w + 1 < word_count; ++w) {
+          for (std::size_t j = 0; j < per_word; ++j) {
+            out[w * per_word + j] = offset((words[w] >> (range_bits * j)) & mask);
+          }
+        }
+        const auto last = (word_count - 1) * per_word;
+        for (std::size_t j = 0; last + j < count; ++j) {
+          out[last + j] = offset((words[word_count - 1] >> (range_bits * j)) & mask);
+        }
+        out = out.subspan(count);
+      }
+    } else {
+      auto values = std::array<std::uint64_t, batch>{};
+      while (!out.empty()) {
+        std::uint64_t leftover;
+        do {
+          leftover = static_cast<std::uint64_t>(internal::generate_entropy<64>(g));
+          for (auto& x : values) {
+            const auto m = static_cast<internal::uint128_t>(leftover) * range;
+            x = static_cast<std::uint64_t>(m >> 64);
+            leftover = static_cast<std::uint64_t>(m);
+          }
+        } while (leftover < batch_threshold);
+
+        if (out.size() >= batch) {
+          for (std::size_t i = 0; i < batch; ++i) { out[i] = offset(values[i]); }
+          out = out.subspan(batch);
+        } else {
+          for (std::size_t i = 0; i < out.size(); ++i) { out[i] = offset(values[i]); }
+          out = {};
+        }
+      }
+    }
+  }
+
+private:
+  using utype = std::make_unsigned_t<result_type>;
+
+  static constexpr auto width =
+      static_cast<utype>(static_cast<utype>(Max) - static_cast<utype>(Min));
+  // the number of values in [Min, Max], or 0 if that is the full range of T
+  static constexpr auto range = static_cast<std::uint64_t>(static_cast<utype>(width + 1u));
+
+  static constexpr int range_bits =
+      range == 0 ? std::numeric_limits<utype>::digits : std::countr_zero(range);
+  static constexpr int multiply_bits = range <= (std::uint64_t{1} << 32) ? 32 : 64;
+
+  // the largest batch of at most 16 values whose product of bounds fits in a 64-bit word
+  static constexpr auto batch = [] {
+    auto k = std::size_t{1};
+    auto product = internal::uint128_t{range};
+    while (k < 16 && product * range <= (internal::uint128_t{1} << 64)) {
+      product *= range;
+      ++k;
+    }
+    return k;
+  }();
+
+  static constexpr auto batch_threshold = [] {
+    auto product = std::uint64_t{1};
+    for (std::size_t i = 0; i < batch; ++i) { product *= range; }
+    return internal::batch_threshold(product);
+  }();
+
+  /**
+   * @brief Returns `Min + x`, computed without signed overflow.
+   */
+  static constexpr auto offset(std::uint64_t x) -> result_type {
+    return static_cast<result_type>(static_cast<utype>(static_cast<utype>(Min) + x));
   }
 };
 
@@ -25,8 +25,18 @@
 #ifndef MATTSEP_RANDOM_ENGINES_HPP_INCLUDED
 #define MATTSEP_RANDOM_ENGINES_HPP_INCLUDED
 
+#include "mattsep/random/engines/background.hpp"
+#include "mattsep/random/engines/chacha.hpp"
 #include "mattsep/random/engines/jsf.hpp"
+#include "mattsep/random/engines/jsfx.hpp"
+#include "mattsep/random/engines/pcg.hpp"
+#include "mattsep/random/engines/philox.hpp"
+#include "mattsep/random/engines/pooled.hpp"
+#include "mattsep/random/engines/romu.hpp"
 #include "mattsep/random/engines/sfc.hpp"
+#include "mattsep/random/engines/sfcx.hpp"
+#include "mattsep/random/engines/wyrand.hpp"
+#include "mattsep/random/engines/xoshiro.hpp"
 
 namespace mattsep::random {
   using default_random_engine = engines::jsf64;
@@ -0,0 +1,198 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_ENGINES_BACKGROUND_HPP_INCLUDED
+#define MATTSEP_RANDOM_ENGINES_BACKGROUND_HPP_INCLUDED
+
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <stop_token>
+#include <thread>
+#include <utility>
+
+#include "mattsep/random/concepts.hpp"
+#include "mattsep/random/internal.hpp"
+
+namespace mattsep::random::engines {
+
+/**
+ * @brief An engine adapter that generates output ahead of time on a background thread.
+ *
+ * A producer thread owns the wrapped engine and fills a single-producer/single-consumer ring of
+ * cache-aligned blocks using the engine's bulk path. `operator()` only reads from the current block
+ * and, once per block, publishes the block as free and picks up the next one.
+ *
+ * If the producer has fallen behind and the ring is empty, the value is instead generated inline
+ * from a second engine owned by the consumer, which is split off the wrapped engine on
+ * construction. Such fallbacks are counted in `stats()`. The output is therefore only reproducible
+ * when no fallbacks occur.
+ *
+ * Only one thread may draw from the adapter at a time.
+ *
+ * @tparam Engine The wrapped engine
+ * @tparam BlockSize The number of values in each block of the ring
+ * @tparam Blocks The number of blocks in the ring
+ */
+template <uniform_random_bit_generator Engine, std::size_t BlockSize = 64, std::size_t Blocks = 64>
+class background {
+  static_assert(BlockSize > 0 && Blocks > 1);
+
+public:
+  using engine_type = Engine;
+  using result_type = typename Engine::result_type;
+
+  struct statistics {
+    unsigned long long blocks = 0;
+    unsigned long long fallbacks = 0;
+  };
+
+  background() : background(engine_type{}) {}
+
+  explicit background(engine_type engine)
+      : fallback_{derive(engine)}
+      , engine_{std::move(engine)}
+      , producer_{[this](std::stop_token stop) { produce(stop); }} {}
+
+  background(background const&) = delete;
+  auto operator=(background const&) -> background& = delete;
+
+  ~background() {
+    producer_.request_stop();
+    // Wake the producer if it is waiting for room in the ring; it checks for the stop request
+    // before producing anything further.
+    consumed_.fetch_add(1, std::memory_order_release);
+    consumed_.notify_one();
+  }
+
+  auto operator()() noexcept -> result_type {
+    if (index_ == BlockSize && !acquire()) [[unlikely]] {
+      ++stats_.fallbacks;
+      return fallback_();
+    }
+    return ring_[(taken_ - 1) % Blocks].values[index_++];
+  }
+
+  /**
+   * @brief Returns the number of blocks consumed and of values generated inline so far.
+   *
+   * Must be called from the consuming thread.
+   */
+  auto stats() const noexcept -> statistics {
+    return stats_;
+  }
+
+  /**
+   * @brief Returns the number of filled blocks waiting in the ring.
+   */
+  auto available() const noexcept -> std::size_t {
+    return produced_.load(std::memory_order_acquire) - taken_;
+  }
+
+  static constexpr auto min() -> result_type {
+    return Engine::min();
+  }
+
+  static constexpr auto max() -> result_type {
+    return Engine::max();
+  }
+
+private:
+  static constexpr std::size_t cache_line = 64;
+
+  struct alignas(cache_line) block {
+    std::array<result_type, BlockSize> values;
+  };
+
+  // consumer state
+  engine_type fallback_;
+  std::size_t index_ = BlockSize;
+  std::size_t taken_ = 0;
+  std::size_t produced_cache_ = 0;
+  bool holding_ = false;
+  statistics stats_ = {};
+
+  // shared state, each counter on its own cache line
+  alignas(cache_line) std::atomic<std::size_t> produced_ = 0;
+  alignas(cache_line) std::atomic<std::size_t> consumed_ = 0;
+  std::array<block, Blocks> ring_;
+
+  // producer state
+  alignas(cache_line) engine_type engine_;
+  std::jthread producer_;
+
+  static auto derive(engine_type& engine) -> engine_type {
+    if constexpr (requires { engine.split(); }) {
+      return engine.split();
+    } else {
+      static_assert(std::constructible_from<engine_type, result_type>,
+                    "background requires an engine with split() or a single-word seed");
+      return engine_type{internal::mix(engine())};
+    }
+  }
+
+  /**
+   * @brief Releases the current block, if any, and moves on to the next filled one.
+   *
+   * @return false if the ring is empty
+   */
+  auto acquire() noexcept -> bool {
+    if (holding_) {
+      consumed_.store(taken_, std::memory_order_release);
+      consumed_.notify_one();
+      holding_ = false;
+    }
+
+    if (produced_cache_ == taken_) {
+      produced_cache_ = produced_.load(std::memory_order_acquire);
+      if (produced_cache_ == taken_) { return false; }
+    }
+
+    ++taken_;
+    ++stats_.blocks;
+    holding_ = true;
+    index_ = 0;
+    return true;
+  }
+
+  auto produce(std::stop_token const& stop) -> void {
+    auto produced = std::size_t{0};
+    while (!stop.stop_requested()) {
+      const auto consumed = consumed_.load(std::memory_order_acquire);
+      if (produced - consumed >= Blocks) {
+        consumed_.wait(consumed, std::memory_order_acquire);
+        continue;
+      }
+
+      internal::generate(engine_, std::span{ring_[produced % Blocks].values});
+      produced_.store(++produced, std::memory_order_release);
+    }
+  }
+};
+
+}  // namespace mattsep::random::engines
+
+#endif
@@ -0,0 +1,404 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_ENGINES_CHACHA_HPP_INCLUDED
+#define MATTSEP_RANDOM_ENGINES_CHACHA_HPP_INCLUDED
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+
+#include "mattsep/random/internal.hpp"
+#include "mattsep/random/internal/simd.hpp"
+#include "mattsep/random/seeding.hpp"
+
+namespace mattsep::random::engines {
+
+/**
+ * @brief A cryptographically secure engine producing the ChaCha keystream of Bernstein.
+ *
+ * Block `n` of stream `s` is the ChaCha block function of the key with a 64-bit block counter `n`
+ * in words 12 and 13 and the 64-bit stream id `s` in words 14 and 15, as in Bernstein's original
+ * design. Each output is two keystream words, the first in the low half, so `fill_bytes` writes
+ * the keystream itself. Blocks are computed 16 at a time, one per vector lane, into a buffer of
+ * 1 KiB; bulk requests of that size or more are written straight to the output.
+ *
+ * A default-constructed engine takes its key from the operating system (see `os_entropy`). The
+ * other constructors are deterministic: a 64-bit seed is convenient for tests and simulations but
+ * is not a secret key.
+ *
+ * @tparam Rounds The number of rounds: 20 for the standard cipher, 8 or 12 for reduced margins
+ */
+template <int Rounds>
+class chacha {
+  static_assert(Rounds > 0 && Rounds % 2 == 0, "chacha requires an even number of rounds");
+
+public:
+  using result_type = std::uint64_t;
+  using key_type = std::array<std::uint32_t, 8>;
+  using block_type = std::array<std::uint32_t, 16>;
+  using state_type = std::array<result_type, 7>;
+
+  chacha() {
+    seed();
+  }
+
+  chacha(result_type s, result_type stream = 0) noexcept {
+    seed(s, stream);
+  }
+
+  explicit chacha(key_type const& key, result_type stream = 0) noexcept {
+    seed(key, stream);
+  }
+
+  explicit chacha(std::span<result_type const> material) noexcept {
+    seed(material);
+  }
+
+  /**
+   * @brief Seeds the engine with a 256-bit key from the operating system, on stream 0.
+   *
+   * @throws std::system_error if the operating system reports an error
+   */
+  auto seed() -> void {
+    auto key = key_type{};
+    os_entropy(std::as_writable_bytes(std::span{key}));
+    seed(key);
+  }
+
+  /**
+   * @brief Seeds the engine with a key of four SplitMix64 outputs from @a s.
+   */
+  auto seed(result_type s, result_type stream = 0) noexcept -> void {
+    auto words = std::array<result_type, 4>{};
+    internal::splitmix(s, 0, std::span<result_type>{words});
+    seed(split_words(words), stream);
+  }
+
+  auto seed(key_type const& key, result_type stream = 0) noexcept -> void {
+    key_ = key;
+    stream_ = stream;
+    seek(0);
+  }
+
+  /**
+   * @brief Seeds the engine with a key expanded from @a material, which may be of any length.
+   */
+  auto seed(std::span<result_type const> material) noexcept -> void {
+    seed(internal::seed_hash{material});
+  }
+
+  /**
+   * @brief Seeds the engine from material already absorbed into @a hash, as `seed_many` does.
+   */
+  auto seed(internal::seed_hash const& hash) noexcept -> void {
+    auto words = std::array<result_type, 4>{};
+    hash.expand(std::span<result_type>{words});
+    seed(split_words(words));
+  }
+
+  auto key() const noexcept -> key_type const& {
+    return key_;
+  }
+
+  auto stream() const noexcept -> result_type {
+    return stream_;
+  }
+
+  /**
+   * @brief Returns the key, the stream, and the block and word of the next output.
+   */
+  auto state() const noexcept -> state_type {
+    const auto [block, offset] = position();
+    return {join(key_[0], key_[1]), join(key_[2], key_[3]), join(key_[4], key_[5]),
+            join(key_[6], key_[7]), stream_, block, offset};
+  }
+
+  static auto from_state(state_type const& s) noexcept -> chacha {
+    auto engine = chacha{split_words({s[0], s[1], s[2], s[3]}), s[4]};
+    engine.seek(s[5], static_cast<std::size_t>(s[6] % words_per_block));
+    return engine;
+  }
+
+  /**
+   * @brief Applies the ChaCha block function to block @a counter of stream @a stream.
+   */
+  static constexpr auto block(key_type const& key, std::uint64_t counter,
+                              std::uint64_t stream) noexcept -> block_type {
+    const auto input = block_type{sigma[0], sigma[1], sigma[2], sigma[3],
+                                  key[0],   key[1],   key[2],   key[3],
+                                  key[4],   key[5],   key[6],   key[7],
+                                  static_cast<std::uint32_t>(counter),
+                                  static_cast<std::uint32_t>(counter >> 32),
+                                  static_cast<std::uint32_t>(stream),
+                                  static_cast<std::uint32_t>(stream >> 32)};
+
+    auto x = input;
+    auto quarter = [&x](std::size_t a, std::size_t b, std::size_t c, std::size_t d) {
+      x[a] += x[b];
+      x[d] = std::rotl(x[d] ^ x[a], 16);
+      x[c] += x[d];
+      x[b] = std::rotl(x[b] ^ x[c], 12);
+      x[a] += x[b];
+      x[d] = std::rotl(x[d] ^ x[a], 8);
+      x[c] += x[d];
+      x[b] = std::rotl(x[b] ^ x[c], 7);
+    };
+    for (int r = 0; r < Rounds; r += 2) {
+      quarter(0, 4, 8, 12);
+      quarter(1, 5, 9, 13);
+      quarter(2, 6, 10, 14);
+      quarter(3, 7, 11, 15);
+      quarter(0, 5, 10, 15);
+      quarter(1, 6, 11, 12);
+      quarter(2, 7, 8, 13);
+      quarter(3, 4, 9, 14);
+    }
+    for (std::size_t i = 0; i < 16; ++i) { x[i] += input[i]; }
+    return x;
+  }
+
+  /**
+   * @brief Moves the engine to the start of block @a counter in constant time.
+   */
+  auto seek(std::uint64_t counter) noexcept -> void {
+    counter_ = counter;
+    index_ = buffer_size;
+  }
+
+  /**
+   * @brief Returns a child engine keyed by the next 256 bits of this engine's keystream.
+   */
+  auto split() -> chacha {
+    auto words = std::array<result_type, 4>{};
+    generate(words);
+    return chacha{split_words(words)};
+  }
+
+  auto next() noexcept -> result_type {
+    if (index_ == buffer_size) { refill(); }
+    return buffer_[index_++];
+  }
+
+  /**
+   * @brief Advances the engine by @a n outputs in constant time.
+   */
+  auto discard(unsigned long long n) noexcept -> void {
+    if (index_ != buffer_size && n < buffer_size - index_) {
+      index_ += static_cast<std::size_t>(n);
+      return;
+    }
+    const auto [block, offset] = position();
+    const auto words = static_cast<internal::uint128_t>(offset) + n;
+    seek(block + static_cast<std::uint64_t>(words / words_per_block),
+         static_cast<std::size_t>(words % words_per_block));
+  }
+
+  /**
+   * @brief Fills @a out with the next `out.size()` outputs of the engine.
+   *
+   * Equivalent to assigning `next()` to each element in turn. Whole batches of blocks are
+   * computed directly into @a out.
+   */
+  auto generate(std::span<result_type> out) noexcept -> void {
+    if (index_ < buffer_size) {
+      const auto count = std::min(out.size(), buffer_size - index_);
+      const auto rest = std::span{buffer_}.subspan(index_, count);
+      std::copy(rest.begin(), rest.end(), out.begin());
+      index_ += rest.size();
+      out = out.subspan(rest.size());
+    }
+    while (out.size() >= buffer_size) {
+      generate_blocks(key_, counter_, stream_, out.template first<buffer_size>());
+      counter_ += batch_blocks;
+      out = out.subspan(buffer_size);
+    }
+    if (!out.empty()) {
+      refill();
+      index_ = std::min(out.size(), buffer_size);
+      std::copy_n(buffer_.begin(), index_, out.begin());
+    }
+  }
+
+  auto operator()() noexcept -> result_type {
+    return next();
+  }
+
+  auto operator==(chacha const& rhs) const noexcept -> bool {
+    return state() == rhs.state();
+  }
+
+  static constexpr auto min() -> result_type {
+    return std::numeric_limits<result_type>::min();
+  }
+
+  static constexpr auto max() -> result_type {
+    return std::numeric_limits<result_type>::max();
+  }
+
+private:
+  // "expand 32-byte k"
+  static constexpr auto sigma = std::array<std::uint32_t, 4>{0x61707865, 0x3320646E, 0x79622D32,
+                                                              0x6B206574};
+
+#if defined(__AVX512F__)
+  static constexpr std::size_t lanes = 16;
+#elif defined(__AVX2__)
+  static constexpr std::size_t lanes = 8;
+#else
+  static constexpr std::size_t lanes = 4;
+#endif
+
+  static constexpr std::size_t words_per_block = 8;
+  static constexpr std::size_t batch_blocks = 16;
+  static constexpr std::size_t buffer_size = words_per_block * batch_blocks;
+
+  key_type key_;
+  result_type stream_;
+  // the block following those in the buffer
+  std::uint64_t counter_;
+  alignas(64) std::array<result_type, buffer_size> buffer_;
+  std::size_t index_;
+
+  static constexpr auto join(std::uint32_t lo, std::uint32_t hi) noexcept -> result_type {
+    return lo | (static_cast<result_type>(hi) << 32);
+  }
+
+  static constexpr auto split_words(std::array<result_type, 4> const& words) noexcept
+      -> key_type {
+    auto key = key_type{};
+    for (std::size_t i = 0; i < 4; ++i) {
+      key[2 * i] = static_cast<std::uint32_t>(words[i]);
+      key[2 * i + 1] = static_cast<std::uint32_t>(words[i] >> 32);
+    }
+    return key;
+  }
+
+  /**
+   * @brief Returns the block holding the next output and the output's index within it.
+   */
+  auto position() const noexcept -> std::array<std::uint64_t, 2> {
+    if (index_ == buffer_size) { return {counter_, 0}; }
+    return {counter_ - batch_blocks + index_ / words_per_block, index_ % words_per_block};
+  }
+
+  auto seek(std::uint64_t counter, std::size_t offset) noexcept -> void {
+    seek(counter);
+    if (offset != 0) {
+      refill();
+      index_ = offset;
+    }
+  }
+
+  auto refill() noexcept -> void {
+    generate_blocks(key_, counter_, stream_, std::span{buffer_});
+    counter_ += batch_blocks;
+    index_ = 0;
+  }
+
+  template <class V>
+  static auto quarter(V& a, V& b, V& c, V& d) noexcept -> void {
+    namespace simd = internal::simd;
+    a = a + b;
+    d = simd::rotl<16>(d ^ a);
+    c = c + d;
+    b = simd::rotl<12>(b ^ c);
+    a = a + b;
+    d = simd::rotl<8>(d ^ a);
+    c = c + d;
+    b = simd::rotl<7>(b ^ c);
+  }
+
+  /**
+   * @brief Writes blocks `counter` to `counter + batch_blocks - 1` to @a out.
+   *
+   * Each vector holds one state word of `lanes` consecutive blocks, so the rounds need no
+   * shuffles; the words are interleaved back into block order at the end.
+   */
+  static auto generate_blocks(key_type const& key, std::uint64_t counter, std::uint64_t stream,
+                              std::span<result_type, buffer_size> out) noexcept -> void {
+    using vec_type = internal::simd::vec<std::uint32_t, lanes>;
+
+    for (std::size_t first = 0; first < batch_blocks; first += lanes) {
+      auto low = std::array<std::uint32_t, lanes>{};
+      auto high = std::array<std::uint32_t, lanes>{};
+      for (std::size_t j = 0; j < lanes; ++j) {
+        const auto c = counter + first + j;
+        low[j] = static_cast<std::uint32_t>(c);
+        high[j] = static_cast<std::uint32_t>(c >> 32);
+      }
+
+      const auto input = std::array<vec_type, 16>{
+          vec_type::broadcast(sigma[0]),
+          vec_type::broadcast(sigma[1]),
+          vec_type::broadcast(sigma[2]),
+          vec_type::broadcast(sigma[3]),
+          vec_type::broadcast(key[0]),
+          vec_type::broadcast(key[1]),
+          vec_type::broadcast(key[2]),
+          vec_type::broadcast(key[3]),
+          vec_type::broadcast(key[4]),
+          vec_type::broadcast(key[5]),
+          vec_type::broadcast(key[6]),
+          vec_type::broadcast(key[7]),
+          vec_type::load(low.data()),
+          vec_type::load(high.data()),
+          vec_type::broadcast(static_cast<std::uint32_t>(stream)),
+          vec_type::broadcast(static_cast<std::uint32_t>(stream >> 32))};
+
+      auto x = input;
+      for (int r = 0; r < Rounds; r += 2) {
+        quarter(x[0], x[4], x[8], x[12]);
+        quarter(x[1], x[5], x[9], x[13]);
+        quarter(x[2], x[6], x[10], x[14]);
+        quarter(x[3], x[7], x[11], x[15]);
+        quarter(x[0], x[5], x[10], x[15]);
+        quarter(x[1], x[6], x[11], x[12]);
+        quarter(x[2], x[7], x[8], x[13]);
+        quarter(x[3], x[4], x[9], x[14]);
+      }
+
+      auto words = std::array<std::array<std::uint32_t, lanes>, 16>{};
+      for (std::size_t i = 0; i < 16; ++i) { (x[i] + input[i]).store(words[i].data()); }
+      for (std::size_t j = 0; j < lanes; ++j) {
+        for (std::size_t k = 0; k < words_per_block; ++k) {
+          out[words_per_block * (first + j) + k] = join(words[2 * k][j], words[2 * k + 1][j]);
+        }
+      }
+    }
+  }
+};
+
+using chacha8 = chacha<8>;
+using chacha12 = chacha<12>;
+using chacha20 = chacha<20>;
+
+}  // namespace mattsep::random::engines
+
+#endif
@@ -25,10 +25,14 @@
 #ifndef MATTSEP_RANDOM_ENGINES_JSF_HPP_INCLUDED
 #define MATTSEP_RANDOM_ENGINES_JSF_HPP_INCLUDED
 
+#include <array>
 #include <bit>
 #include <concepts>
 #include <cstdint>
 #include <limits>
+#include <span>
+
+#include "mattsep/random/internal.hpp"
 
 namespace mattsep::random::engines {
 
@@ -36,20 +40,85 @@ template <std::unsigned_integral ResultType, int P, int Q, int R>
 class jsf {
 public:
   using result_type = ResultType;
+  using state_type = std::array<result_type, 4>;
 
   static constexpr result_type default_seed = 0x8085EEDull;
 
-  jsf(result_type s = default_seed) noexcept {
+  constexpr jsf(result_type s = default_seed) noexcept {
     seed(s);
   }
 
-  auto seed(result_type s) noexcept -> void {
+  constexpr jsf(result_type s, result_type stream) noexcept {
+    seed(s, stream);
+  }
+
+  constexpr explicit jsf(std::span<result_type const> material) noexcept {
+    seed(material);
+  }
+
+  constexpr auto seed(result_type s) noexcept -> void {
+    seed(s, 0);
+  }
+
+  /**
+   * @brief Seeds the engine with @a s on the stream selected by @a stream.
+   *
+   * The stream id is mixed and folded into two of the three seeded state words, so that nearby ids
+   * start from unrelated states. Stream 0 is the classic single-word seeding, `b = c = d = s`.
+   */
+  constexpr auto seed(result_type s, result_type stream) noexcept -> void {
     a_ = magic;
-    b_ = c_ = d_ = s;
+    b_ = s;
+    c_ = d_ = s ^ internal::mix(stream);
     discard(20);
   }
 
-  auto next() noexcept -> result_type {
+  /**
+   * @brief Seeds the engine from @a material, which may be of any length.
+   *
+   * The words b, c and d are taken from `internal::seed_hash`, so no warm-up rounds are run and
+   * distinct material gives unrelated states.
+   */
+  constexpr auto seed(std::span<result_type const> material) noexcept -> void {
+    seed(internal::seed_hash{material});
+  }
+
+  /**
+   * @brief Seeds the engine from material already absorbed into @a hash, as `seed_many` does.
+   */
+  constexpr auto seed(internal::seed_hash const& hash) noexcept -> void {
+    auto bcd = std::array<result_type, 3>{};
+    hash.expand(std::span<result_type>{bcd});
+    a_ = magic;
+    b_ = bcd[0];
+    c_ = bcd[1];
+    d_ = bcd[2];
+  }
+
+  /**
+   * @brief Returns the state words `{a, b, c, d}`, from which `from_state` restores the engine.
+   */
+  constexpr auto state() const noexcept -> state_type {
+    return {a_, b_, c_, d_};
+  }
+
+  static constexpr auto from_state(state_type const& s) noexcept -> jsf {
+    return jsf{restore_tag{}, s};
+  }
+
+  /**
+   * @brief Returns a child engine for use alongside this one.
+   *
+   * The child is seeded from two outputs of this engine, one selecting its seed and the other its
+   * stream, so repeated splits (including splits of children) need no central coordination.
+   */
+  constexpr auto split() noexcept -> jsf {
+    auto s = next();
+    auto stream = next();
+    return jsf{s, stream};
+  }
+
+  constexpr auto next() noexcept -> result_type {
     result_type e_;
     e_ = a_ - std::rotl(b_, P);
     a_ = b_ ^ std::rotl(c_, Q);
@@ -59,11 +128,33 @@ public:
     return d_;
   }
 
-  auto discard(unsigned long long n) noexcept -> void {
+  constexpr auto discard(unsigned long long n) noexcept -> void {
     while (n-- != 0) { next(); }
   }
 
-  auto operator()() noexcept -> result_type {
+  /**
+   * @brief Fills @a out with the next `out.size()` outputs of the engine.
+   *
+   * Equivalent to assigning `next()` to each element in turn. The state is held in locals for the
+   * duration of the loop, since the output may otherwise alias the state words.
+   */
+  constexpr auto generate(std::span<result_type> out) noexcept -> void {
+    auto a = a_, b = b_, c = c_, d = d_;
+    for (auto& x : out) {
+      auto e = a - std::rotl(b, P);
+      a = b ^ std::rotl(c, Q);
+      b = c + std::rotl(d, R);
+      c = d + e;
+      d = e + a;
+      x = d;
+    }
+    a_ = a;
+    b_ = b;
+    c_ = c;
+    d_ = d;
+  }
+
+  constexpr auto operator()() noexcept -> result_type {
     return next();
   }
 
@@ -80,6 +171,11 @@ public:
 private:
   static constexpr result_type magic = 0xF1EA5EEDull;
   result_type a_, b_, c_, d_;
+
+  struct restore_tag {};
+
+  constexpr jsf(restore_tag, state_type const& s) noexcept
+      : a_{s[0]}, b_{s[1]}, c_{s[2]}, d_{s[3]} {}
 };
 
 using jsf32 = jsf<std::uint32_t, 27, 17, 0>;
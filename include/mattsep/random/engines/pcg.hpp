@@ -0,0 +1,220 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_ENGINES_PCG_HPP_INCLUDED
+#define MATTSEP_RANDOM_ENGINES_PCG_HPP_INCLUDED
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+#include "mattsep/random/internal.hpp"
+
+namespace mattsep::random::engines {
+
+/**
+ * @brief O'Neill's PCG64-DXSM: a 128-bit LCG with the "double xorshift multiply" output function.
+ *
+ * This is the variant used by NumPy's `PCG64DXSM`. The LCG uses a 64-bit multiplier, and the
+ * output is taken from the state before each step. Since the state is an LCG, `advance` moves it
+ * any distance in O(log n) steps, and each odd increment gives a distinct stream.
+ */
+class pcg64_dxsm {
+public:
+  using result_type = std::uint64_t;
+  using state_type = std::array<result_type, 4>;
+
+  static constexpr result_type default_seed = 0x9C65EED;
+
+  constexpr pcg64_dxsm(result_type s = default_seed) noexcept {
+    seed(s);
+  }
+
+  constexpr pcg64_dxsm(result_type s, result_type stream) noexcept {
+    seed(s, stream);
+  }
+
+  constexpr explicit pcg64_dxsm(std::span<result_type const> material) noexcept {
+    seed(material);
+  }
+
+  constexpr auto seed(result_type s) noexcept -> void {
+    seed(s, 0);
+  }
+
+  /**
+   * @brief Seeds the engine with @a s on the stream selected by @a stream, as `pcg_srandom_r` does.
+   */
+  constexpr auto seed(result_type s, result_type stream) noexcept -> void {
+    seed_words(s, stream);
+  }
+
+  /**
+   * @brief Seeds the engine from @a material, which may be of any length.
+   *
+   * The 128-bit seed and stream are taken from `internal::seed_hash`.
+   */
+  constexpr auto seed(std::span<result_type const> material) noexcept -> void {
+    seed(internal::seed_hash{material});
+  }
+
+  /**
+   * @brief Seeds the engine from material already absorbed into @a hash, as `seed_many` does.
+   */
+  constexpr auto seed(internal::seed_hash const& hash) noexcept -> void {
+    auto words = std::array<result_type, 4>{};
+    hash.expand(std::span<result_type>{words});
+    seed_words(join(words[0], words[1]), join(words[2], words[3]));
+  }
+
+  /**
+   * @brief Returns `{state high, state low, increment high, increment low}`.
+   */
+  constexpr auto state() const noexcept -> state_type {
+    return {high(state_), low(state_), high(increment_), low(increment_)};
+  }
+
+  static constexpr auto from_state(state_type const& s) noexcept -> pcg64_dxsm {
+    return pcg64_dxsm{restore_tag{}, s};
+  }
+
+  /**
+   * @brief Returns a child engine whose seed and stream are the next two outputs of this one.
+   */
+  constexpr auto split() noexcept -> pcg64_dxsm {
+    auto s = next();
+    auto stream = next();
+    return pcg64_dxsm{s, stream};
+  }
+
+  constexpr auto next() noexcept -> result_type {
+    const auto result = output(state_);
+    state_ = state_ * multiplier + increment_;
+    return result;
+  }
+
+  /**
+   * @brief Advances the engine by @a n outputs in O(log n) time.
+   *
+   * Uses Brown's method: the affine map `x -> a x + c` of one step is squared once per bit of @a n,
+   * and the squares for the set bits are composed.
+   */
+  constexpr auto advance(internal::uint128_t n) noexcept -> void {
+    auto acc_mult = internal::uint128_t{1};
+    auto acc_plus = internal::uint128_t{0};
+    auto cur_mult = internal::uint128_t{multiplier};
+    auto cur_plus = increment_;
+    while (n != 0) {
+      if ((n & 1u) != 0) {
+        acc_mult *= cur_mult;
+        acc_plus = acc_plus * cur_mult + cur_plus;
+      }
+      cur_plus *= cur_mult + 1;
+      cur_mult *= cur_mult;
+      n >>= 1;
+    }
+    state_ = acc_mult * state_ + acc_plus;
+  }
+
+  constexpr auto discard(unsigned long long n) noexcept -> void {
+    advance(n);
+  }
+
+  /**
+   * @brief Fills @a out with the next `out.size()` outputs of the engine.
+   *
+   * Equivalent to assigning `next()` to each element in turn, with the state held in a local.
+   */
+  constexpr auto generate(std::span<result_type> out) noexcept -> void {
+    auto state = state_;
+    const auto increment = increment_;
+    for (auto& x : out) {
+      x = output(state);
+      state = state * multiplier + increment;
+    }
+    state_ = state;
+  }
+
+  constexpr auto operator()() noexcept -> result_type {
+    return next();
+  }
+
+  constexpr auto operator==(pcg64_dxsm const& rhs) const noexcept -> bool {
+    return state_ == rhs.state_ && increment_ == rhs.increment_;
+  }
+
+  static constexpr auto min() -> result_type {
+    return std::numeric_limits<result_type>::min();
+  }
+
+  static constexpr auto max() -> result_type {
+    return std::numeric_limits<result_type>::max();
+  }
+
+private:
+  static constexpr result_type multiplier = 0xDA942042E4DD58B5;
+
+  internal::uint128_t state_;
+  internal::uint128_t increment_;
+
+  struct restore_tag {};
+
+  constexpr pcg64_dxsm(restore_tag, state_type const& s) noexcept
+      : state_{join(s[0], s[1])}, increment_{join(s[2], s[3])} {}
+
+  static constexpr auto join(result_type hi, result_type lo) noexcept -> internal::uint128_t {
+    return (internal::uint128_t{hi} << 64) | lo;
+  }
+
+  static constexpr auto high(internal::uint128_t x) noexcept -> result_type {
+    return static_cast<result_type>(x >> 64);
+  }
+
+  static constexpr auto low(internal::uint128_t x) noexcept -> result_type {
+    return static_cast<result_type>(x);
+  }
+
+  static constexpr auto output(internal::uint128_t state) noexcept -> result_type {
+    auto hi = high(state);
+    const auto lo = low(state) | 1u;
+    hi ^= hi >> 32;
+    hi *= multiplier;
+    hi ^= hi >> 48;
+    hi *= lo;
+    return hi;
+  }
+
+  constexpr auto seed_words(internal::uint128_t s, internal::uint128_t stream) noexcept -> void {
+    state_ = 0;
+    increment_ = (stream << 1) | 1u;
+    next();
+    state_ += s;
+    next();
+  }
+};
+
+}  // namespace mattsep::random::engines
+
+#endif
@@ -0,0 +1,309 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_ENGINES_PHILOX_HPP_INCLUDED
+#define MATTSEP_RANDOM_ENGINES_PHILOX_HPP_INCLUDED
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+#include "mattsep/random/internal.hpp"
+
+namespace mattsep::random::engines {
+
+/**
+ * @brief The Philox4xW counter-based generator of Salmon et al. (SC '11).
+ *
+ * Output block `n` is a keyed bijection of the counter `n`, so the engine can be moved to any
+ * position in constant time and any output can be computed without touching the engine state. The
+ * key is formed from the seed and a stream id. Within a block, words are produced in order.
+ *
+ * @tparam ResultType A 32- or 64-bit unsigned integer type
+ * @tparam Rounds The number of rounds; 10 is the standard choice
+ */
+template <std::unsigned_integral ResultType, int Rounds>
+class philox {
+  static constexpr auto word_bits = std::numeric_limits<ResultType>::digits;
+  static_assert(word_bits == 32 || word_bits == 64, "philox requires 32- or 64-bit words");
+
+public:
+  using result_type = ResultType;
+  using counter_type = std::array<result_type, 4>;
+  using key_type = std::array<result_type, 2>;
+  using state_type = std::array<result_type, 7>;
+
+  static constexpr auto default_seed = static_cast<result_type>(0xC7125EED);
+
+  constexpr philox(result_type s = default_seed, result_type stream = 0) noexcept {
+    seed(s, stream);
+  }
+
+  constexpr explicit philox(std::span<result_type const> material) noexcept {
+    seed(material);
+  }
+
+  constexpr auto seed(result_type s, result_type stream = 0) noexcept -> void {
+    key_ = {s, stream};
+    counter_ = {};
+    index_ = 4;
+  }
+
+  /**
+   * @brief Seeds the engine with a key expanded from @a material, which may be of any length.
+   */
+  constexpr auto seed(std::span<result_type const> material) noexcept -> void {
+    seed(internal::seed_hash{material});
+  }
+
+  /**
+   * @brief Seeds the engine from material already absorbed into @a hash, as `seed_many` does.
+   */
+  constexpr auto seed(internal::seed_hash const& hash) noexcept -> void {
+    hash.expand(std::span<result_type>{key_});
+    counter_ = {};
+    index_ = 4;
+  }
+
+  constexpr auto key() const noexcept -> key_type const& {
+    return key_;
+  }
+
+  /**
+   * @brief Returns the key, the counter and the read position within the current block.
+   */
+  constexpr auto state() const noexcept -> state_type {
+    return {key_[0],     key_[1],     counter_[0], counter_[1],
+            counter_[2], counter_[3], static_cast<result_type>(index_)};
+  }
+
+  /**
+   * @brief Restores an engine from `state()`, recomputing the one block it has buffered.
+   */
+  static constexpr auto from_state(state_type const& s) noexcept -> philox {
+    auto engine = philox{};
+    engine.key_ = {s[0], s[1]};
+    engine.counter_ = {s[2], s[3], s[4], s[5]};
+    engine.index_ = std::min(static_cast<std::size_t>(s[6]), std::size_t{4});
+    if (engine.index_ != 4) {
+      auto ctr = engine.counter_;
+      retreat(ctr);
+      engine.buffer_ = block(ctr, engine.key_);
+    }
+    return engine;
+  }
+
+  /**
+   * @brief Applies the Philox bijection to @a ctr under @a key.
+   */
+  static constexpr auto block(counter_type const& ctr, key_type const& key) noexcept
+      -> counter_type {
+    auto x = ctr;
+    auto k = key;
+    for (int r = 0; r < Rounds; ++r) {
+      if (r != 0) {
+        k[0] += weyl0;
+        k[1] += weyl1;
+      }
+      auto [hi0, lo0] = mulhilo(mult0, x[0]);
+      auto [hi1, lo1] = mulhilo(mult1, x[2]);
+      x = {hi1 ^ x[1] ^ k[0], lo1, hi0 ^ x[3] ^ k[1], lo0};
+    }
+    return x;
+  }
+
+  /**
+   * @brief Returns the @a n-th output of the stream, counting from its start.
+   *
+   * This does not depend on or change the current position of the engine.
+   */
+  constexpr auto operator[](unsigned long long n) const noexcept -> result_type {
+    auto ctr = counter_type{};
+    advance(ctr, n / 4);
+    return block(ctr, key_)[n % 4];
+  }
+
+  constexpr auto next() noexcept -> result_type {
+    if (index_ == 4) { refill(); }
+    return buffer_[index_++];
+  }
+
+  /**
+   * @brief Advances the engine by @a n outputs in constant time.
+   */
+  constexpr auto discard(unsigned long long n) noexcept -> void {
+    // The buffer holds block `counter_ - 1`, and index_ words of it have been used.
+    const auto total = static_cast<internal::uint128_t>(index_) + n;
+    if (total <= 4) {
+      index_ = static_cast<std::size_t>(total);
+      return;
+    }
+
+    const auto blocks = (total - 1) / 4;
+    advance(counter_, blocks);
+    index_ = static_cast<std::size_t>(total - 4 * blocks);
+    if (index_ != 4) {
+      auto ctr = counter_;
+      retreat(ctr);
+      buffer_ = block(ctr, key_);
+    }
+  }
+
+  /**
+   * @brief Fills @a out with the next `out.size()` outputs of the engine.
+   *
+   * Whole blocks are computed several counters at a time in a structure-of-arrays layout, which
+   * lets the compiler keep one counter per vector lane.
+   */
+  constexpr auto generate(std::span<result_type> out) noexcept -> void {
+    const auto buffered = std::min(out.size(), 4 - index_);
+    std::copy_n(buffer_.begin() + static_cast<std::ptrdiff_t>(index_), buffered, out.begin());
+    index_ += buffered;
+    out = out.subspan(buffered);
+
+    while (out.size() >= 4 * batch) {
+      generate_batch(out.template first<4 * batch>());
+      out = out.subspan(4 * batch);
+    }
+
+    while (out.size() >= 4) {
+      auto x = block(counter_, key_);
+      advance(counter_, 1);
+      std::copy(x.begin(), x.end(), out.begin());
+      out = out.subspan(4);
+    }
+
+    if (!out.empty()) {
+      refill();
+      std::copy_n(buffer_.begin(), out.size(), out.begin());
+      index_ = out.size();
+    }
+  }
+
+  constexpr auto operator()() noexcept -> result_type {
+    return next();
+  }
+
+  constexpr auto operator==(philox const& rhs) const noexcept -> bool {
+    // The buffer is a cache of block(counter_ - 1), so it need not be compared.
+    return key_ == rhs.key_ && counter_ == rhs.counter_ && index_ == rhs.index_;
+  }
+
+  static constexpr auto min() -> result_type {
+    return std::numeric_limits<result_type>::min();
+  }
+
+  static constexpr auto max() -> result_type {
+    return std::numeric_limits<result_type>::max();
+  }
+
+private:
+  static constexpr std::size_t batch = 8;
+
+  static constexpr result_type mult0 = word_bits == 32 ? 0xD2511F53 : 0xD2E7470EE14C6C93;
+  static constexpr result_type mult1 = word_bits == 32 ? 0xCD9E8D57 : 0xCA5A826395121157;
+  static constexpr result_type weyl0 = word_bits == 32 ? 0x9E3779B9 : 0x9E3779B97F4A7C15;
+  static constexpr result_type weyl1 = word_bits == 32 ? 0xBB67AE85 : 0xBB67AE8584CAA73B;
+
+  key_type key_;
+  counter_type counter_;
+  counter_type buffer_ = {};
+  std::size_t index_;
+
+  static constexpr auto mulhilo(result_type a, result_type b) noexcept
+      -> std::array<result_type, 2> {
+    using wide_t = internal::uint_least_bits_t<2 * word_bits>;
+    const auto product = static_cast<wide_t>(a) * static_cast<wide_t>(b);
+    return {static_cast<result_type>(product >> word_bits), static_cast<result_type>(product)};
+  }
+
+  /**
+   * @brief Adds @a n to the multi-word counter @a ctr, least significant word first.
+   */
+  static constexpr auto advance(counter_type& ctr, internal::uint128_t n) noexcept -> void {
+    for (auto& word : ctr) {
+      const auto sum = static_cast<internal::uint128_t>(word) + static_cast<result_type>(n);
+      word = static_cast<result_type>(sum);
+      n = (n >> word_bits) + (sum >> word_bits);
+      if (n == 0) { break; }
+    }
+  }
+
+  static constexpr auto retreat(counter_type& ctr) noexcept -> void {
+    for (auto& word : ctr) {
+      if (word-- != 0) { break; }
+    }
+  }
+
+  constexpr auto refill() noexcept -> void {
+    buffer_ = block(counter_, key_);
+    advance(counter_, 1);
+    index_ = 0;
+  }
+
+  constexpr auto generate_batch(std::span<result_type, 4 * batch> out) noexcept -> void {
+    std::array<result_type, batch> x0, x1, x2, x3;
+    for (std::size_t j = 0; j < batch; ++j) {
+      x0[j] = counter_[0];
+      x1[j] = counter_[1];
+      x2[j] = counter_[2];
+      x3[j] = counter_[3];
+      advance(counter_, 1);
+    }
+
+    auto k = key_;
+    for (int r = 0; r < Rounds; ++r) {
+      if (r != 0) {
+        k[0] += weyl0;
+        k[1] += weyl1;
+      }
+      for (std::size_t j = 0; j < batch; ++j) {
+        auto [hi0, lo0] = mulhilo(mult0, x0[j]);
+        auto [hi1, lo1] = mulhilo(mult1, x2[j]);
+        x0[j] = hi1 ^ x1[j] ^ k[0];
+        x1[j] = lo1;
+        x2[j] = hi0 ^ x3[j] ^ k[1];
+        x3[j] = lo0;
+      }
+    }
+
+    for (std::size_t j = 0; j < batch; ++j) {
+      out[4 * j + 0] = x0[j];
+      out[4 * j + 1] = x1[j];
+      out[4 * j + 2] = x2[j];
+      out[4 * j + 3] = x3[j];
+    }
+  }
+};
+
+using philox4x32 = philox<std::uint32_t, 10>;
+using philox4x64 = philox<std::uint64_t, 10>;
+
+}  // namespace mattsep::random::engines
+
+#endif
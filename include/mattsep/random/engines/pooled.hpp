@@ -0,0 +1,208 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_ENGINES_POOLED_HPP_INCLUDED
+#define MATTSEP_RANDOM_ENGINES_POOLED_HPP_INCLUDED
+
+#include <array>
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+#include "mattsep/random/concepts.hpp"
+#include "mattsep/random/internal.hpp"
+
+namespace mattsep::random::engines {
+
+/**
+ * @brief An engine adapter that keeps the unused bits of each engine word for later requests.
+ *
+ * Distributions ask for a number of random bits through `internal::generate_entropy<K>`, which
+ * normally draws a whole engine word and discards whatever it does not need. With this adapter
+ * such requests are served from a 64-bit pool instead, so a fair coin costs one bit of engine
+ * output rather than a full word. Calls to `operator()`, `generate` and `discard` pass straight
+ * through to the wrapped engine and leave the pool untouched.
+ *
+ * @tparam Engine The wrapped engine
+ */
+template <uniform_random_bit_generator Engine>
+class pooled {
+public:
+  using engine_type = Engine;
+  using result_type = typename Engine::result_type;
+  using state_type = std::array<std::uint64_t, internal::state_size_v<Engine> + 2>;
+
+  constexpr pooled() = default;
+  constexpr explicit pooled(engine_type engine) noexcept : engine_{std::move(engine)} {}
+
+  constexpr auto seed(result_type s) noexcept -> void
+  requires requires(engine_type& e, result_type x) { e.seed(x); }
+  {
+    engine_.seed(s);
+    pool_ = 0;
+    count_ = 0;
+  }
+
+  constexpr auto seed(std::span<result_type const> material) noexcept -> void
+  requires requires(engine_type& e, std::span<result_type const> x) { e.seed(x); }
+  {
+    engine_.seed(material);
+    pool_ = 0;
+    count_ = 0;
+  }
+
+  constexpr auto seed(internal::seed_hash const& hash) noexcept -> void
+  requires requires(engine_type& e) { e.seed(hash); }
+  {
+    engine_.seed(hash);
+    pool_ = 0;
+    count_ = 0;
+  }
+
+  constexpr auto operator()() noexcept -> result_type {
+    return engine_();
+  }
+
+  constexpr auto generate(std::span<result_type> out) noexcept -> void {
+    internal::generate(engine_, out);
+  }
+
+  /**
+   * @brief Skips @a n raw outputs, through the wrapped engine's own `discard` where it has one.
+   */
+  constexpr auto discard(unsigned long long n) noexcept -> void {
+    if constexpr (requires { engine_.discard(n); }) {
+      engine_.discard(n);
+    } else {
+      for (; n > 0; --n) { engine_(); }
+    }
+  }
+
+  /**
+   * @brief Returns @a K uniformly random bits, taken from the pool where possible.
+   */
+  template <int K>
+  requires(0 < K && K <= 64)
+  constexpr auto entropy() noexcept -> internal::uint_least_bits_t<K> {
+    using type = internal::uint_least_bits_t<K>;
+    if (count_ >= K) { return static_cast<type>(take(K)); }
+
+    const auto have = count_;
+    const auto low = pool_;
+    refill();
+    return static_cast<type>(low | (take(K - have) << have));
+  }
+
+  /**
+   * @brief Returns the pool without consuming it, refilling it first if it is empty.
+   *
+   * Only the lowest `pooled_bits()` bits are meaningful, and they are served lowest first. Together
+   * with `consume` this lets a caller use exactly as many bits as a value turns out to need.
+   */
+  constexpr auto peek() noexcept -> std::uint64_t {
+    if (count_ == 0) { refill(); }
+    return pool_;
+  }
+
+  /**
+   * @brief Drops the lowest @a n bits of the pool, where `0 < n <= pooled_bits()`.
+   */
+  constexpr auto consume(int n) noexcept -> void {
+    // two shifts, since shifting by all 64 bits at once is undefined
+    pool_ = (pool_ >> (n - 1)) >> 1;
+    count_ -= n;
+  }
+
+  /**
+   * @brief Returns the number of bits currently held in the pool.
+   */
+  [[nodiscard]] constexpr auto pooled_bits() const noexcept -> int {
+    return count_;
+  }
+
+  /**
+   * @brief Returns the wrapped engine's state words widened to 64 bits, then the pool and its size.
+   */
+  constexpr auto state() const noexcept -> state_type
+  requires restorable_random_bit_generator<engine_type>
+  {
+    auto s = state_type{};
+    const auto inner = engine_.state();
+    std::copy(inner.begin(), inner.end(), s.begin());
+    s[inner.size()] = pool_;
+    s[inner.size() + 1] = static_cast<std::uint64_t>(count_);
+    return s;
+  }
+
+  static constexpr auto from_state(state_type const& s) noexcept -> pooled
+  requires restorable_random_bit_generator<engine_type>
+  {
+    auto inner = typename engine_type::state_type{};
+    for (std::size_t i = 0; i < inner.size(); ++i) {
+      inner[i] = static_cast<typename engine_type::state_type::value_type>(s[i]);
+    }
+    auto result = pooled{engine_type::from_state(inner)};
+    result.pool_ = s[inner.size()];
+    result.count_ = static_cast<int>(std::min<std::uint64_t>(s[inner.size() + 1], 64));
+    return result;
+  }
+
+  [[nodiscard]] constexpr auto engine() const noexcept -> engine_type const& {
+    return engine_;
+  }
+
+  static constexpr auto min() -> result_type {
+    return Engine::min();
+  }
+
+  static constexpr auto max() -> result_type {
+    return Engine::max();
+  }
+
+  auto operator==(pooled const&) const -> bool = default;
+
+private:
+  engine_type engine_ = {};
+  std::uint64_t pool_ = 0;
+  int count_ = 0;
+
+  constexpr auto refill() noexcept -> void {
+    pool_ = static_cast<std::uint64_t>(internal::generate_entropy<64>(engine_));
+    count_ = 64;
+  }
+
+  constexpr auto take(int n) noexcept -> std::uint64_t {
+    count_ -= n;
+    if (n == 64) { return std::exchange(pool_, 0); }
+    const auto x = pool_ & ((std::uint64_t{1} << n) - 1);
+    pool_ >>= n;
+    return x;
+  }
+};
+
+}  // namespace mattsep::random::engines
+
+#endif
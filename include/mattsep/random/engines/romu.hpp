@@ -0,0 +1,174 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_ENGINES_ROMU_HPP_INCLUDED
+#define MATTSEP_RANDOM_ENGINES_ROMU_HPP_INCLUDED
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+#include "mattsep/random/internal.hpp"
+
+namespace mattsep::random::engines {
+
+/**
+ * @brief RomuTrio, the three-word rotate-multiply generator of Overton.
+ *
+ * Each output is the first state word from before the step, so the step's multiply is off the
+ * critical path between outputs. The period is not fixed but is at least 2^50 for all but a
+ * vanishing fraction of seeds, enough for most uses and not for very long runs. There is no jump
+ * function; separate engines should be seeded separately.
+ */
+class romu_trio {
+public:
+  using result_type = std::uint64_t;
+  using state_type = std::array<result_type, 3>;
+
+  static constexpr result_type default_seed = 0x40415EED;
+
+  constexpr romu_trio(result_type s = default_seed) noexcept {
+    seed(s);
+  }
+
+  constexpr romu_trio(result_type s, result_type stream) noexcept {
+    seed(s, stream);
+  }
+
+  constexpr explicit romu_trio(std::span<result_type const> material) noexcept {
+    seed(material);
+  }
+
+  constexpr auto seed(result_type s) noexcept -> void {
+    seed(s, 0);
+  }
+
+  /**
+   * @brief Seeds the engine with three outputs of SplitMix64 on the stream @a stream.
+   */
+  constexpr auto seed(result_type s, result_type stream) noexcept -> void {
+    auto xyz = state_type{};
+    internal::splitmix(s, stream, std::span<result_type>{xyz});
+    x_ = xyz[0];
+    y_ = xyz[1];
+    z_ = xyz[2];
+  }
+
+  /**
+   * @brief Seeds the engine from @a material, which may be of any length.
+   */
+  constexpr auto seed(std::span<result_type const> material) noexcept -> void {
+    seed(internal::seed_hash{material});
+  }
+
+  /**
+   * @brief Seeds the engine from material already absorbed into @a hash, as `seed_many` does.
+   */
+  constexpr auto seed(internal::seed_hash const& hash) noexcept -> void {
+    auto xyz = state_type{};
+    hash.expand(std::span<result_type>{xyz});
+    x_ = xyz[0];
+    y_ = xyz[1];
+    z_ = xyz[2];
+  }
+
+  constexpr auto state() const noexcept -> state_type {
+    return {x_, y_, z_};
+  }
+
+  static constexpr auto from_state(state_type const& s) noexcept -> romu_trio {
+    return romu_trio{restore_tag{}, s};
+  }
+
+  /**
+   * @brief Returns a child engine whose seed and stream are the next two outputs of this one.
+   */
+  constexpr auto split() noexcept -> romu_trio {
+    auto s = next();
+    auto stream = next();
+    return romu_trio{s, stream};
+  }
+
+  constexpr auto next() noexcept -> result_type {
+    const auto x = x_, y = y_, z = z_;
+    x_ = multiplier * z;
+    y_ = std::rotl(y - x, 12);
+    z_ = std::rotl(z - y, 44);
+    return x;
+  }
+
+  constexpr auto discard(unsigned long long n) noexcept -> void {
+    while (n-- != 0) { next(); }
+  }
+
+  /**
+   * @brief Fills @a out with the next `out.size()` outputs of the engine.
+   *
+   * Equivalent to assigning `next()` to each element in turn. The state is held in locals for the
+   * duration of the loop, since the output may otherwise alias the state words.
+   */
+  constexpr auto generate(std::span<result_type> out) noexcept -> void {
+    auto x = x_, y = y_, z = z_;
+    for (auto& out_x : out) {
+      out_x = x;
+      const auto xp = x, yp = y;
+      x = multiplier * z;
+      y = std::rotl(yp - xp, 12);
+      z = std::rotl(z - yp, 44);
+    }
+    x_ = x;
+    y_ = y;
+    z_ = z;
+  }
+
+  constexpr auto operator()() noexcept -> result_type {
+    return next();
+  }
+
+  auto operator==(romu_trio const& rhs) const noexcept -> bool = default;
+
+  static constexpr auto min() -> result_type {
+    return std::numeric_limits<result_type>::min();
+  }
+
+  static constexpr auto max() -> result_type {
+    return std::numeric_limits<result_type>::max();
+  }
+
+private:
+  static constexpr result_type multiplier = 15241094284759029579u;
+
+  result_type x_, y_, z_;
+
+  struct restore_tag {};
+
+  constexpr romu_trio(restore_tag, state_type const& s) noexcept
+      : x_{s[0]}, y_{s[1]}, z_{s[2]} {}
+};
+
+}  // namespace mattsep::random::engines
+
+#endif
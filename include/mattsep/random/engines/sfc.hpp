@@ -25,10 +25,14 @@
 #ifndef MATTSEP_RANDOM_ENGINES_SFC_HPP_INCLUDED
 #define MATTSEP_RANDOM_ENGINES_SFC_HPP_INCLUDED
 
+#include <array>
 #include <bit>
 #include <concepts>
 #include <cstdint>
 #include <limits>
+#include <span>
+
+#include "mattsep/random/internal.hpp"
 
 namespace mattsep::random::engines {
 
@@ -36,20 +40,84 @@ template <std::unsigned_integral ResultType, int P, int Q, int R>
 class sfc {
 public:
   using result_type = ResultType;
+  using state_type = std::array<result_type, 4>;
 
   static constexpr auto default_seed = static_cast<result_type>(0x5FC5EED);
 
-  sfc(result_type s = default_seed) noexcept {
+  constexpr sfc(result_type s = default_seed) noexcept {
     seed(s);
   }
 
-  auto seed(result_type s) noexcept -> void {
+  constexpr sfc(result_type s, result_type stream) noexcept {
+    seed(s, stream);
+  }
+
+  constexpr explicit sfc(std::span<result_type const> material) noexcept {
+    seed(material);
+  }
+
+  constexpr auto seed(result_type s) noexcept -> void {
+    seed(s, 0);
+  }
+
+  /**
+   * @brief Seeds the engine with @a s on the stream selected by @a stream.
+   *
+   * The stream id is mixed and folded into the starting value of the counter `d`, so that nearby
+   * ids start far apart. Stream 0 is the classic single-word seeding, `d = 1`.
+   */
+  constexpr auto seed(result_type s, result_type stream) noexcept -> void {
     a_ = b_ = c_ = s;
-    d_ = 1;
+    d_ = 1 + internal::mix(stream);
     discard(12);
   }
 
-  auto next() noexcept -> result_type {
+  /**
+   * @brief Seeds the engine from @a material, which may be of any length.
+   *
+   * All four words are taken from `internal::seed_hash`, so no warm-up rounds are run and
+   * distinct material gives unrelated states.
+   */
+  constexpr auto seed(std::span<result_type const> material) noexcept -> void {
+    seed(internal::seed_hash{material});
+  }
+
+  /**
+   * @brief Seeds the engine from material already absorbed into @a hash, as `seed_many` does.
+   */
+  constexpr auto seed(internal::seed_hash const& hash) noexcept -> void {
+    auto abcd = std::array<result_type, 4>{};
+    hash.expand(std::span<result_type>{abcd});
+    a_ = abcd[0];
+    b_ = abcd[1];
+    c_ = abcd[2];
+    d_ = abcd[3];
+  }
+
+  /**
+   * @brief Returns the state words `{a, b, c, d}`, from which `from_state` restores the engine.
+   */
+  constexpr auto state() const noexcept -> state_type {
+    return {a_, b_, c_, d_};
+  }
+
+  static constexpr auto from_state(state_type const& s) noexcept -> sfc {
+    return sfc{restore_tag{}, s};
+  }
+
+  /**
+   * @brief Returns a child engine for use alongside this one.
+   *
+   * The child's seed and stream id are the next two outputs of this engine. Children may be split
+   * in turn, which lets fork-join code hand out engines without a central seed allocator.
+   */
+  constexpr auto split() noexcept -> sfc {
+    auto s = next();
+    auto stream = next();
+    return sfc{s, stream};
+  }
+
+  constexpr auto next() noexcept -> result_type {
     result_type e_;
     e_ = a_ + b_ + d_++;
     a_ = b_ ^ (b_ >> P);
@@ -58,11 +126,32 @@ public:
     return e_;
   }
 
-  auto discard(unsigned long long n) noexcept -> void {
+  constexpr auto discard(unsigned long long n) noexcept -> void {
     while (n-- != 0) { next(); }
   }
 
-  auto operator()() noexcept -> result_type {
+  /**
+   * @brief Fills @a out with the next `out.size()` outputs of the engine.
+   *
+   * Equivalent to assigning `next()` to each element in turn. The state is held in locals for the
+   * duration of the loop, since the output may otherwise alias the state words.
+   */
+  constexpr auto generate(std::span<result_type> out) noexcept -> void {
+    auto a = a_, b = b_, c = c_, d = d_;
+    for (auto& x : out) {
+      auto e = a + b + d++;
+      a = b ^ (b >> P);
+      b = c + (c << Q);
+      c = e + std::rotl(c, R);
+      x = e;
+    }
+    a_ = a;
+    b_ = b;
+    c_ = c;
+    d_ = d;
+  }
+
+  constexpr auto operator()() noexcept -> result_type {
     return next();
   }
 
@@ -78,6 +167,11 @@ public:
 
 private:
   result_type a_, b_, c_, d_;
+
+  struct restore_tag {};
+
+  constexpr sfc(restore_tag, state_type const& s) noexcept
+      : a_{s[0]}, b_{s[1]}, c_{s[2]}, d_{s[3]} {}
 };
 
 using sfc32 = sfc<std::uint32_t, 9, 3, 21>;
@@ -0,0 +1,210 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_ENGINES_SFCX_HPP_INCLUDED
+#define MATTSEP_RANDOM_ENGINES_SFCX_HPP_INCLUDED
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+#include "mattsep/random/internal.hpp"
+#include "mattsep/random/internal/simd.hpp"
+
+namespace mattsep::random::engines {
+
+/**
+ * @brief Runs @a Lanes independent sfc generators side by side.
+ *
+ * Lane `i` produces exactly the sequence of a scalar `sfc<ResultType, P, Q, R>` given the same
+ * seed. Outputs are interleaved: each step of the lanes yields one block of @a Lanes values, lane
+ * 0 first, and blocks are handed out in order by both `operator()` and `generate`.
+ */
+template <std::unsigned_integral ResultType, int P, int Q, int R, std::size_t Lanes>
+class sfcx {
+public:
+  using result_type = ResultType;
+  using block_type = std::array<result_type, Lanes>;
+  using state_type = std::array<result_type, 5 * Lanes + 1>;
+
+  static constexpr auto default_seed = static_cast<result_type>(0x5FC5EED);
+  static constexpr std::size_t lanes = Lanes;
+
+  sfcx(result_type s = default_seed) noexcept {
+    seed(s);
+  }
+
+  sfcx(block_type const& seeds) noexcept {
+    seed(seeds);
+  }
+
+  /**
+   * @brief Seeds every lane with @a s, lane `i` on stream `i`.
+   *
+   * Lane `i` then matches a scalar `sfc` constructed as `sfc{s, i}`.
+   */
+  auto seed(result_type s) noexcept -> void {
+    auto counters = block_type{};
+    for (std::size_t i = 0; i < Lanes; ++i) {
+      counters[i] = 1 + internal::mix(static_cast<result_type>(i));
+    }
+    seed(vec_type::broadcast(s), vec_type::load(counters.data()));
+  }
+
+  /**
+   * @brief Seeds lane `i` with `seeds[i]`, as a scalar `sfc{seeds[i]}` would be.
+   */
+  auto seed(block_type const& seeds) noexcept -> void {
+    seed(vec_type::load(seeds.data()), vec_type::broadcast(1));
+  }
+
+  /**
+   * @brief Returns the lanes' a, b, c and d words, then the buffered block and its read position.
+   */
+  auto state() const noexcept -> state_type {
+    auto s = state_type{};
+    a_.store(s.data());
+    b_.store(s.data() + Lanes);
+    c_.store(s.data() + 2 * Lanes);
+    d_.store(s.data() + 3 * Lanes);
+    std::copy(block_.begin(), block_.end(), s.begin() + 4 * Lanes);
+    s[5 * Lanes] = static_cast<result_type>(index_);
+    return s;
+  }
+
+  static auto from_state(state_type const& s) noexcept -> sfcx {
+    auto engine = sfcx{restore_tag{}};
+    engine.a_ = vec_type::load(s.data());
+    engine.b_ = vec_type::load(s.data() + Lanes);
+    engine.c_ = vec_type::load(s.data() + 2 * Lanes);
+    engine.d_ = vec_type::load(s.data() + 3 * Lanes);
+    std::copy_n(s.begin() + 4 * Lanes, Lanes, engine.block_.begin());
+    engine.index_ = std::min(static_cast<std::size_t>(s[5 * Lanes]), Lanes);
+    return engine;
+  }
+
+  auto discard(unsigned long long n) noexcept -> void {
+    const auto buffered = std::min<unsigned long long>(n, Lanes - index_);
+    index_ += static_cast<std::size_t>(buffered);
+    n -= buffered;
+
+    while (n >= Lanes) {
+      step(a_, b_, c_, d_);
+      n -= Lanes;
+    }
+
+    if (n != 0) {
+      refill();
+      index_ = static_cast<std::size_t>(n);
+    }
+  }
+
+  /**
+   * @brief Fills @a out with the next `out.size()` outputs of the engine.
+   *
+   * Whole blocks are stored straight into @a out, so the state stays in vector registers for the
+   * bulk of the loop.
+   */
+  auto generate(std::span<result_type> out) noexcept -> void {
+    const auto buffered = std::min(out.size(), Lanes - index_);
+    std::copy_n(block_.begin() + static_cast<std::ptrdiff_t>(index_), buffered, out.begin());
+    index_ += buffered;
+    out = out.subspan(buffered);
+
+    auto a = a_, b = b_, c = c_, d = d_;
+    while (out.size() >= Lanes) {
+      step(a, b, c, d).store(out.data());
+      out = out.subspan(Lanes);
+    }
+    a_ = a;
+    b_ = b;
+    c_ = c;
+    d_ = d;
+
+    if (!out.empty()) {
+      refill();
+      std::copy_n(block_.begin(), out.size(), out.begin());
+      index_ = out.size();
+    }
+  }
+
+  auto operator()() noexcept -> result_type {
+    if (index_ == Lanes) { refill(); }
+    return block_[index_++];
+  }
+
+  auto operator==(sfcx const& rhs) const noexcept -> bool = default;
+
+  static constexpr auto min() -> result_type {
+    return std::numeric_limits<result_type>::min();
+  }
+
+  static constexpr auto max() -> result_type {
+    return std::numeric_limits<result_type>::max();
+  }
+
+private:
+  using vec_type = internal::simd::vec<result_type, Lanes>;
+
+  vec_type a_, b_, c_, d_;
+  block_type block_ = {};
+  std::size_t index_ = Lanes;
+
+  struct restore_tag {};
+  explicit sfcx(restore_tag) noexcept {}
+
+  auto seed(vec_type const& abc, vec_type const& d) noexcept -> void {
+    a_ = b_ = c_ = abc;
+    d_ = d;
+    for (int i = 0; i < 12; ++i) { step(a_, b_, c_, d_); }
+    index_ = Lanes;
+  }
+
+  static auto step(vec_type& a, vec_type& b, vec_type& c, vec_type& d) noexcept -> vec_type {
+    auto e = a + b + d;
+    d = d + vec_type::broadcast(1);
+    a = b ^ internal::simd::shr<P>(b);
+    b = c + internal::simd::shl<Q>(c);
+    c = e + internal::simd::rotl<R>(c);
+    return e;
+  }
+
+  auto refill() noexcept -> void {
+    step(a_, b_, c_, d_).store(block_.data());
+    index_ = 0;
+  }
+};
+
+using sfc32x8 = sfcx<std::uint32_t, 9, 3, 21, 8>;
+using sfc32x16 = sfcx<std::uint32_t, 9, 3, 21, 16>;
+using sfc64x4 = sfcx<std::uint64_t, 11, 3, 24, 4>;
+using sfc64x8 = sfcx<std::uint64_t, 11, 3, 24, 8>;
+
+}  // namespace mattsep::random::engines
+
+#endif
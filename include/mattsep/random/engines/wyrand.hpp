@@ -0,0 +1,164 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_ENGINES_WYRAND_HPP_INCLUDED
+#define MATTSEP_RANDOM_ENGINES_WYRAND_HPP_INCLUDED
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+#include "mattsep/random/internal.hpp"
+
+namespace mattsep::random::engines {
+
+/**
+ * @brief Wang Yi's wyrand: a Weyl sequence hashed by one 64x64 -> 128-bit multiply.
+ *
+ * The state is a single counter, so `discard` takes constant time, and outputs are independent of
+ * one another, so the bulk path has no dependency between iterations beyond the counter. The
+ * period is 2^64, and every seed and stream is a starting point on that one cycle.
+ */
+class wyrand {
+public:
+  using result_type = std::uint64_t;
+  using state_type = std::array<result_type, 1>;
+
+  static constexpr result_type default_seed = 0x3795EED;
+
+  constexpr wyrand(result_type s = default_seed) noexcept {
+    seed(s);
+  }
+
+  constexpr wyrand(result_type s, result_type stream) noexcept {
+    seed(s, stream);
+  }
+
+  constexpr explicit wyrand(std::span<result_type const> material) noexcept {
+    seed(material);
+  }
+
+  constexpr auto seed(result_type s) noexcept -> void {
+    seed(s, 0);
+  }
+
+  /**
+   * @brief Seeds the engine with @a s on the stream selected by @a stream.
+   *
+   * Stream `k` starts `mix(k)` outputs after stream 0, a pseudo-random distance along the cycle.
+   * Stream 0 is the reference seeding, with the counter set to @a s.
+   */
+  constexpr auto seed(result_type s, result_type stream) noexcept -> void {
+    state_ = s + internal::mix(stream) * increment;
+  }
+
+  /**
+   * @brief Seeds the engine from @a material, which may be of any length.
+   */
+  constexpr auto seed(std::span<result_type const> material) noexcept -> void {
+    seed(internal::seed_hash{material});
+  }
+
+  /**
+   * @brief Seeds the engine from material already absorbed into @a hash, as `seed_many` does.
+   */
+  constexpr auto seed(internal::seed_hash const& hash) noexcept -> void {
+    auto words = state_type{};
+    hash.expand(std::span<result_type>{words});
+    state_ = words[0];
+  }
+
+  constexpr auto state() const noexcept -> state_type {
+    return {state_};
+  }
+
+  static constexpr auto from_state(state_type const& s) noexcept -> wyrand {
+    return wyrand{restore_tag{}, s};
+  }
+
+  /**
+   * @brief Returns a child engine starting at a point of the cycle chosen by this engine's output.
+   */
+  constexpr auto split() noexcept -> wyrand {
+    auto s = next();
+    auto stream = next();
+    return wyrand{s, stream};
+  }
+
+  constexpr auto next() noexcept -> result_type {
+    state_ += increment;
+    return hash(state_);
+  }
+
+  constexpr auto discard(unsigned long long n) noexcept -> void {
+    state_ += n * increment;
+  }
+
+  /**
+   * @brief Fills @a out with the next `out.size()` outputs of the engine.
+   *
+   * Equivalent to assigning `next()` to each element in turn, with the counter held in a local.
+   */
+  constexpr auto generate(std::span<result_type> out) noexcept -> void {
+    auto state = state_;
+    for (auto& x : out) {
+      state += increment;
+      x = hash(state);
+    }
+    state_ = state;
+  }
+
+  constexpr auto operator()() noexcept -> result_type {
+    return next();
+  }
+
+  auto operator==(wyrand const& rhs) const noexcept -> bool = default;
+
+  static constexpr auto min() -> result_type {
+    return std::numeric_limits<result_type>::min();
+  }
+
+  static constexpr auto max() -> result_type {
+    return std::numeric_limits<result_type>::max();
+  }
+
+private:
+  static constexpr result_type increment = 0xA0761D6478BD642F;
+
+  result_type state_;
+
+  struct restore_tag {};
+
+  constexpr wyrand(restore_tag, state_type const& s) noexcept : state_{s[0]} {}
+
+  static constexpr auto hash(result_type x) noexcept -> result_type {
+    const auto m = static_cast<internal::uint128_t>(x) * (x ^ 0xE7037ED1A0B428DB);
+    return static_cast<result_type>(m) ^ static_cast<result_type>(m >> 64);
+  }
+};
+
+}  // namespace mattsep::random::engines
+
+#endif
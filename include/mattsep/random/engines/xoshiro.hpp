@@ -0,0 +1,210 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_ENGINES_XOSHIRO_HPP_INCLUDED
+#define MATTSEP_RANDOM_ENGINES_XOSHIRO_HPP_INCLUDED
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+#include "mattsep/random/internal.hpp"
+
+namespace mattsep::random::engines {
+
+/**
+ * @brief The xoshiro256++ generator of Blackman and Vigna, with its jump functions.
+ *
+ * The state is advanced by a linear map, so `jump` and `long_jump` can move it 2^128 and 2^192
+ * steps ahead with 256 steps of work each, which splits one sequence into non-overlapping parts.
+ */
+class xoshiro256pp {
+public:
+  using result_type = std::uint64_t;
+  using state_type = std::array<result_type, 4>;
+
+  static constexpr result_type default_seed = 0x7105EED;
+
+  constexpr xoshiro256pp(result_type s = default_seed) noexcept {
+    seed(s);
+  }
+
+  constexpr xoshiro256pp(result_type s, result_type stream) noexcept {
+    seed(s, stream);
+  }
+
+  constexpr explicit xoshiro256pp(std::span<result_type const> material) noexcept {
+    seed(material);
+  }
+
+  constexpr auto seed(result_type s) noexcept -> void {
+    seed(s, 0);
+  }
+
+  /**
+   * @brief Seeds the engine with @a s on the stream selected by @a stream.
+   *
+   * The state is four outputs of SplitMix64 from @a s, with an increment chosen by the stream (see
+   * `internal::splitmix`); stream 0 is the seeding used by the reference implementation.
+   */
+  constexpr auto seed(result_type s, result_type stream) noexcept -> void {
+    internal::splitmix(s, stream, std::span<result_type>{s_});
+  }
+
+  /**
+   * @brief Seeds the engine from @a material, which may be of any length.
+   */
+  constexpr auto seed(std::span<result_type const> material) noexcept -> void {
+    seed(internal::seed_hash{material});
+  }
+
+  /**
+   * @brief Seeds the engine from material already absorbed into @a hash, as `seed_many` does.
+   */
+  constexpr auto seed(internal::seed_hash const& hash) noexcept -> void {
+    hash.expand(std::span<result_type>{s_});
+  }
+
+  /**
+   * @brief Returns the state words, from which `from_state` restores the engine.
+   */
+  constexpr auto state() const noexcept -> state_type {
+    return s_;
+  }
+
+  static constexpr auto from_state(state_type const& s) noexcept -> xoshiro256pp {
+    return xoshiro256pp{restore_tag{}, s};
+  }
+
+  /**
+   * @brief Returns a child engine seeded from two outputs of this one, as `jsf::split` does.
+   *
+   * Unlike handing out a copy and calling `jump`, this can be repeated on the children.
+   */
+  constexpr auto split() noexcept -> xoshiro256pp {
+    auto s = next();
+    auto stream = next();
+    return xoshiro256pp{s, stream};
+  }
+
+  constexpr auto next() noexcept -> result_type {
+    const auto result = std::rotl(s_[0] + s_[3], 23) + s_[0];
+    const auto t = s_[1] << 17;
+    s_[2] ^= s_[0];
+    s_[3] ^= s_[1];
+    s_[1] ^= s_[2];
+    s_[0] ^= s_[3];
+    s_[2] ^= t;
+    s_[3] = std::rotl(s_[3], 45);
+    return result;
+  }
+
+  constexpr auto discard(unsigned long long n) noexcept -> void {
+    while (n-- != 0) { next(); }
+  }
+
+  /**
+   * @brief Advances the engine by 2^128 outputs.
+   *
+   * Each call gives the start of a sequence of 2^128 outputs that no other call overlaps, for up
+   * to 2^128 calls.
+   */
+  constexpr auto jump() noexcept -> void {
+    apply({0x180EC6D33CFD0ABA, 0xD5A61266F0C9392C, 0xA9582618E03FC9AA, 0x39ABDC4529B1661C});
+  }
+
+  /**
+   * @brief Advances the engine by 2^192 outputs, to hand out starting points for `jump`.
+   */
+  constexpr auto long_jump() noexcept -> void {
+    apply({0x76E15D3EFEFDCBBF, 0xC5004E441C522FB3, 0x77710069854EE241, 0x39109BB02ACBE635});
+  }
+
+  /**
+   * @brief Fills @a out with the next `out.size()` outputs of the engine.
+   *
+   * Equivalent to assigning `next()` to each element in turn. The state is held in locals for the
+   * duration of the loop, since the output may otherwise alias the state words.
+   */
+  constexpr auto generate(std::span<result_type> out) noexcept -> void {
+    auto s0 = s_[0], s1 = s_[1], s2 = s_[2], s3 = s_[3];
+    for (auto& x : out) {
+      x = std::rotl(s0 + s3, 23) + s0;
+      const auto t = s1 << 17;
+      s2 ^= s0;
+      s3 ^= s1;
+      s1 ^= s2;
+      s0 ^= s3;
+      s2 ^= t;
+      s3 = std::rotl(s3, 45);
+    }
+    s_ = {s0, s1, s2, s3};
+  }
+
+  constexpr auto operator()() noexcept -> result_type {
+    return next();
+  }
+
+  auto operator==(xoshiro256pp const& rhs) const noexcept -> bool = default;
+
+  static constexpr auto min() -> result_type {
+    return std::numeric_limits<result_type>::min();
+  }
+
+  static constexpr auto max() -> result_type {
+    return std::numeric_limits<result_type>::max();
+  }
+
+private:
+  state_type s_;
+
+  struct restore_tag {};
+
+  constexpr xoshiro256pp(restore_tag, state_type const& s) noexcept : s_{s} {}
+
+  /**
+   * @brief Replaces the state with its image under the jump polynomial given by @a poly.
+   *
+   * The new state is the sum, over the set bits `k` of @a poly, of the state after `k` steps.
+   */
+  constexpr auto apply(state_type const& poly) noexcept -> void {
+    auto sum = state_type{};
+    for (auto word : poly) {
+      for (int b = 0; b < 64; ++b) {
+        if ((word >> b) & 1u) {
+          for (std::size_t i = 0; i < 4; ++i) { sum[i] ^= s_[i]; }
+        }
+        next();
+      }
+    }
+    s_ = sum;
+  }
+};
+
+}  // namespace mattsep::random::engines
+
+#endif
@@ -25,9 +25,15 @@
 #ifndef MATTSEP_RANDOM_INTERNAL_HPP_INCLUDED
 #define MATTSEP_RANDOM_INTERNAL_HPP_INCLUDED
 
+#include <algorithm>
+#include <array>
 #include <bit>
+#include <concepts>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <limits>
+#include <span>
 #include <type_traits>
 #include <utility>
 
@@ -75,17 +81,106 @@ struct uint_least_bits {
 template <int N>
 using uint_least_bits_t = typename uint_least_bits<N>::type;
 
+/**
+ * @brief A bijective mixing function with good avalanche behaviour.
+ *
+ * Used to turn small, structured inputs (such as consecutive stream ids) into well-distributed
+ * words. The 64-bit variant is the SplitMix64 finalizer; the 32-bit variant is the "lowbias32" hash
+ * of Wellons. Both map zero to zero.
+ */
+template <std::unsigned_integral T>
+constexpr auto mix(T x) noexcept -> T {
+  static_assert(sizeof(T) == 4 || sizeof(T) == 8, "mix() supports 32- and 64-bit words only");
+  if constexpr (sizeof(T) == 8) {
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ull;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBull;
+    x ^= x >> 31;
+  } else {
+    x ^= x >> 16;
+    x *= 0x7FEB352Du;
+    x ^= x >> 15;
+    x *= 0x846CA68Bu;
+    x ^= x >> 16;
+  }
+  return x;
+}
+
+/**
+ * @brief The hash that expands seed material of any length into engine state.
+ *
+ * The length and the words of the material are absorbed into two 64-bit accumulators, one through
+ * the SplitMix64 finalizer and one by multiply-rotate. Output word `j` is the finalizer applied to
+ * the `j`-th step of a Weyl sequence from the first accumulator, combined with a distinct odd
+ * multiple of the second, so that states differ whenever either accumulator does. Every word of
+ * the material affects every output word, and the result can be used as an engine state without a
+ * warm-up.
+ *
+ * Material can be absorbed in parts, so that a prefix shared by many engines is hashed only once;
+ * the length absorbed first must then be the length of the whole.
+ */
+class seed_hash {
+public:
+  constexpr explicit seed_hash(std::uint64_t length) noexcept {
+    absorb(length);
+  }
+
+  template <std::unsigned_integral T>
+  constexpr explicit seed_hash(std::span<T const> material) noexcept : seed_hash{material.size()} {
+    for (auto w : material) { absorb(static_cast<std::uint64_t>(w)); }
+  }
+
+  constexpr auto absorb(std::uint64_t w) noexcept -> void {
+    h1_ = mix(h1_ ^ w) + golden;
+    h2_ = std::rotl((h2_ ^ w) * odd, 29);
+  }
+
+  template <std::unsigned_integral U>
+  constexpr auto expand(std::span<U> out) const noexcept -> void {
+    auto weyl = h1_;
+    auto multiplier = std::uint64_t{1};
+    for (auto& x : out) {
+      weyl += golden;
+      x = static_cast<U>(mix(weyl) ^ (h2_ * multiplier));
+      multiplier += 2;
+    }
+  }
+
+private:
+  static constexpr auto golden = std::uint64_t{0x9E3779B97F4A7C15};
+  static constexpr auto odd = std::uint64_t{0xD1B54A32D192ED03};
+
+  std::uint64_t h1_ = 0x243F6A8885A308D3;
+  std::uint64_t h2_ = 0x13198A2E03707344;
+};
+
+/**
+ * @brief Fills @a out with successive SplitMix64 outputs from @a s, on the stream @a stream.
+ *
+ * The stream selects the increment of the Weyl sequence, `golden + 2 * mix(stream)`, which is
+ * always odd. Stream 0 is plain SplitMix64, the seeding recommended for xoshiro and Romu engines.
+ */
+constexpr auto splitmix(std::uint64_t s, std::uint64_t stream,
+                        std::span<std::uint64_t> out) noexcept -> void {
+  const auto gamma = std::uint64_t{0x9E3779B97F4A7C15} + 2 * mix(stream);
+  for (auto& x : out) {
+    s += gamma;
+    x = mix(s);
+  }
+}
+
 template <uniform_random_bit_generator G>
 static consteval auto engine_entropy() -> int {
   using result_type = std::invoke_result_t<G&>;
   constexpr auto w = std::numeric_limits<result_type>::digits;
-  constexpr auto r = G::max() - G::min() + 1;
+  constexpr auto r = static_cast<result_type>(G::max() - G::min() + 1);
   constexpr auto n = (w - 1) - std::countl_zero(r);
   return (n < 0) ? w : n;
 }
 
 template <int K, uniform_random_bit_generator G>
-auto generate_entropy(G& g) {
+constexpr auto generate_entropy(G& g) {
   static_assert(K >= 0, "Cannot generate negative entropy!");
 
   using result_type = typename G::result_type;
@@ -100,6 +195,9 @@ auto generate_entropy(G& g) {
 
   if constexpr (K == 0) {
     return utype{0};
+  } else if constexpr (K <= 64 && requires { g.template entropy<K>(); }) {
+    // the engine keeps a pool of leftover bits (see engines::pooled)
+    return static_cast<utype>(g.template entropy<K>());
   } else if constexpr (saturated) {
     constexpr auto count = K / entropy + (K % entropy != 0);
     constexpr auto shift = count * entropy - K;
@@ -127,13 +225,207 @@ auto generate_entropy(G& g) {
       // write result as 2^L * a + b, 0 <= a < 2^(K - L), 0 <= b < 2^L
       // L must satisfy 0 < L < K; we choose L = K / 2.
       constexpr auto L = K / 2;
-      auto a = utype(generate_entropy<K - L>());
-      auto b = utype(generate_entropy<L>());
+      auto a = utype(generate_entropy<K - L>(g));
+      auto b = utype(generate_entropy<L>(g));
       return (a << L) | b;
     }
   }
 }
 
+/**
+ * @brief Returns the rejection threshold for a batch of bounded values with the given product.
+ *
+ * A @a product of 0 stands for 2^64, which needs no rejection.
+ */
+constexpr auto batch_threshold(std::uint64_t product) noexcept -> std::uint64_t {
+  return product == 0 ? 0 : (0 - product) % product;
+}
+
+/**
+ * @brief Draws one value from each range [0, bounds[i]) using a single 64-bit word where possible.
+ *
+ * This is the batched form of Lemire's method (Brackett-Rozinsky and Lemire, "Batched Ranged Random
+ * Integer Generation", 2024). The word is multiplied by each bound in turn: the high half of each
+ * product is a value and the low half feeds the next multiplication. The values are unbiased
+ * provided the whole batch is redrawn while the final low half is below @a threshold, which must
+ * be `batch_threshold(p)` for the product `p` of the bounds. That product must not exceed 2^64.
+ */
+template <uniform_random_bit_generator G>
+constexpr auto bounded_batch(G& g, std::span<std::uint64_t const> bounds,
+                             std::span<std::uint64_t> out, std::uint64_t threshold) -> void {
+  std::uint64_t leftover;
+  do {
+    leftover = static_cast<std::uint64_t>(generate_entropy<64>(g));
+    for (std::size_t i = 0; i < bounds.size(); ++i) {
+      const auto m = static_cast<uint128_t>(leftover) * bounds[i];
+      out[i] = static_cast<std::uint64_t>(m >> 64);
+      leftover = static_cast<std::uint64_t>(m);
+    }
+  } while (leftover < threshold);
+}
+
+/**
+ * @brief Fills @a out so that `out[t]` is uniform on [0, n - t), several values to a word.
+ *
+ * This is the index sequence of a Fisher-Yates shuffle of @a n elements. Each batch takes as many
+ * values as keep the product of their bounds at or below 2^60 (six values per word for n up to
+ * 2^10, down to one above 2^30). A word can then only need rejecting when its final low half is
+ * below the product, which happens for at most one word in 16, so the rejection threshold and its
+ * 64-bit division are only computed for those. Requires `n >= out.size()`.
+ */
+template <uniform_random_bit_generator G>
+constexpr auto bounded_countdown(G& g, std::uint64_t n, std::span<std::uint64_t> out) -> void {
+  auto bounds = std::array<std::uint64_t, 6>{};
+
+  for (std::size_t t = 0; t < out.size();) {
+    const auto top = n - t;
+    const std::size_t batch = top <= (std::uint64_t{1} << 10)   ? 6
+                              : top <= (std::uint64_t{1} << 12) ? 5
+                              : top <= (std::uint64_t{1} << 15) ? 4
+                              : top <= (std::uint64_t{1} << 20) ? 3
+                              : top <= (std::uint64_t{1} << 30) ? 2
+                                                                : 1;
+    const auto k = std::min(out.size() - t, batch);
+
+    auto product = std::uint64_t{1};
+    for (std::size_t i = 0; i < k; ++i) {
+      bounds[i] = top - i;
+      product *= bounds[i];
+    }
+
+    const auto batch_bounds = std::span<std::uint64_t const>{bounds}.first(k);
+    const auto batch_out = out.subspan(t, k);
+    auto leftover = static_cast<std::uint64_t>(generate_entropy<64>(g));
+    for (std::size_t i = 0; i < k; ++i) {
+      const auto m = static_cast<uint128_t>(leftover) * batch_bounds[i];
+      batch_out[i] = static_cast<std::uint64_t>(m >> 64);
+      leftover = static_cast<std::uint64_t>(m);
+    }
+    if (leftover < product) {
+      const auto threshold = batch_threshold(product);
+      if (leftover < threshold) { bounded_batch(g, batch_bounds, batch_out, threshold); }
+    }
+    t += k;
+  }
+}
+
+/**
+ * @brief Hints that the cache line holding @a p will soon be written.
+ */
+inline auto prefetch_for_write([[maybe_unused]] void const* p) noexcept -> void {
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch(p, 1);
+#endif
+}
+
+/**
+ * @brief The number of words in the state of @a G, or 0 if it cannot be saved and restored.
+ */
+template <class G>
+inline constexpr std::size_t state_size_v = 0;
+
+template <restorable_random_bit_generator G>
+inline constexpr std::size_t state_size_v<G> = std::tuple_size_v<typename G::state_type>;
+
+/**
+ * @brief Fills @a out with raw output from @a g.
+ *
+ * Uses the engine's own bulk generation path when it has one, and falls back to calling the engine
+ * once per element otherwise.
+ */
+template <uniform_random_bit_generator G>
+constexpr auto generate(G& g, std::span<typename G::result_type> out) -> void {
+  if constexpr (bulk_random_bit_generator<G>) {
+    g.generate(out);
+  } else {
+    for (auto& x : out) { x = g(); }
+  }
+}
+
+/**
+ * @brief Fills @a out with uniformly random 64-bit words drawn from @a g.
+ *
+ * Full-range 64-bit engines hand over their output directly, using any bulk path they have; every
+ * other engine has its output combined into 64-bit words one at a time.
+ */
+template <uniform_random_bit_generator G>
+constexpr auto generate_words(G& g, std::span<std::uint64_t> out) -> void {
+  using result_type = typename G::result_type;
+
+  if constexpr (std::same_as<result_type, std::uint64_t> && engine_entropy<G>() == 64) {
+    generate(g, out);
+  } else {
+    for (auto& x : out) { x = static_cast<std::uint64_t>(generate_entropy<64>(g)); }
+  }
+}
+
+/**
+ * @brief Fills @a out with values drawn from @a dist using @a g.
+ *
+ * Uses the distribution's batched `generate` member when it has one, and falls back to one call
+ * per element otherwise.
+ */
+template <class Distribution, uniform_random_bit_generator G, class T>
+constexpr auto generate(Distribution& dist, G& g, std::span<T> out) -> void {
+  if constexpr (requires { dist.generate(g, out); }) {
+    dist.generate(g, out);
+  } else {
+    for (auto& x : out) { x = dist(g); }
+  }
+}
+
+/**
+ * @brief Copies the first @a n bytes of @a words to @a out in native byte order.
+ *
+ * Equivalent to `std::memcpy`, which is not usable in constant expressions.
+ */
+template <std::unsigned_integral T>
+constexpr auto copy_bytes(T const* words, std::byte* out, std::size_t n) -> void {
+  if (std::is_constant_evaluated()) {
+    for (std::size_t i = 0; i < n; ++i) {
+      const auto k = i % sizeof(T);
+      const auto position = std::endian::native == std::endian::little ? k : sizeof(T) - 1 - k;
+      out[i] = static_cast<std::byte>(words[i / sizeof(T)] >> (8 * position));
+    }
+  } else {
+    std::memcpy(out, words, n);
+  }
+}
+
+/**
+ * @brief Fills @a out with uniformly random bytes drawn from @a g.
+ *
+ * Engines producing every value of their result type are drawn from in blocks and the words are
+ * copied out in native byte order; any trailing partial word is taken from the leading bytes of one
+ * more engine output. Other engines are sampled one byte at a time.
+ */
+template <uniform_random_bit_generator G>
+constexpr auto fill_bytes(G& g, std::span<std::byte> out) -> void {
+  using result_type = typename G::result_type;
+
+  constexpr auto full_range =
+      (G::min() == 0) && (G::max() == std::numeric_limits<result_type>::max());
+
+  if constexpr (full_range) {
+    constexpr auto block_size = std::size_t{256} / sizeof(result_type);
+    auto block = std::array<result_type, block_size>{};
+
+    while (out.size() >= sizeof(result_type)) {
+      const auto count = std::min(block_size, out.size() / sizeof(result_type));
+      generate(g, std::span{block}.first(count));
+      copy_bytes(block.data(), out.data(), count * sizeof(result_type));
+      out = out.subspan(count * sizeof(result_type));
+    }
+
+    if (!out.empty()) {
+      const auto x = g();
+      copy_bytes(&x, out.data(), out.size());
+    }
+  } else {
+    for (auto& x : out) { x = static_cast<std::byte>(generate_entropy<8>(g)); }
+  }
+}
+
 }  // namespace mattsep::random::internal
 
 #endif
\ No newline at end of file
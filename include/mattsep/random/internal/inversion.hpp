@@ -0,0 +1,95 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_INTERNAL_INVERSION_HPP_INCLUDED
+#define MATTSEP_RANDOM_INTERNAL_INVERSION_HPP_INCLUDED
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace mattsep::random::internal {
+
+/**
+ * @brief The cumulative probabilities of the first values of a distribution on {0, 1, 2, ...},
+ * for sampling by inversion.
+ *
+ * The table is built from p(0) and the ratios p(k + 1) / p(k). A draw binary searches it, and the
+ * rare values past its end are reached by carrying on with the same ratios. Once the ratios reach
+ * zero the last cumulative probability is raised to infinity, so rounding cannot carry a draw
+ * past the end of the support.
+ */
+class inversion_table {
+public:
+  static constexpr std::size_t size = 64;
+
+  constexpr inversion_table() = default;
+
+  template <class Ratio>
+  constexpr inversion_table(double p0, Ratio ratio) {
+    auto f = p0;
+    auto sum = 0.0;
+    for (std::size_t k = 0; k < size; ++k) {
+      sum += f;
+      cdf_[k] = sum;
+      f *= ratio(static_cast<double>(k));
+      if (f == 0.0) {
+        std::fill(cdf_.begin() + static_cast<std::ptrdiff_t>(k), cdf_.end(),
+                  std::numeric_limits<double>::infinity());
+        break;
+      }
+    }
+    tail_ = f;
+  }
+
+  /**
+   * @brief Returns the smallest k whose cumulative probability exceeds @a u.
+   */
+  template <class Ratio>
+  [[nodiscard]] constexpr auto find(double u, Ratio ratio) const -> std::uint64_t {
+    const auto it = std::upper_bound(cdf_.begin(), cdf_.end(), u);
+    if (it != cdf_.end()) { return static_cast<std::uint64_t>(it - cdf_.begin()); }
+
+    auto k = static_cast<std::uint64_t>(size);
+    auto f = tail_;
+    auto sum = cdf_.back();
+    while (true) {
+      sum += f;
+      const auto next = f * ratio(static_cast<double>(k));
+      if (u < sum || next == 0.0) { return k; }
+      f = next;
+      ++k;
+    }
+  }
+
+private:
+  std::array<double, size> cdf_ = {};
+  double tail_ = 0.0;  // p(size)
+};
+
+}  // namespace mattsep::random::internal
+
+#endif
@@ -0,0 +1,151 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_INTERNAL_MATH_HPP_INCLUDED
+#define MATTSEP_RANDOM_INTERNAL_MATH_HPP_INCLUDED
+
+#include <bit>
+#include <cstdint>
+#include <limits>
+
+/*
+ * Elementary functions for the non-uniform distributions.
+ *
+ * These are written in plain IEEE double arithmetic rather than calling <cmath>, for two reasons:
+ * they can be evaluated at compile time (to build lookup tables), and they give the same result on
+ * every compiler and standard library, so a distribution's output depends only on the engine and
+ * its seed. They are accurate to within a couple of ulps over the ranges the library needs, and
+ * make no attempt to handle NaNs or to set errno.
+ */
+
+namespace mattsep::random::internal::math {
+
+inline constexpr double ln2_hi = 6.93147180369123816490e-01;
+inline constexpr double ln2_lo = 1.90821492927058770002e-10;
+inline constexpr double inv_ln2 = 1.44269504088896338700e+00;
+
+/**
+ * @brief Returns 2^k as a double, for -1074 <= k <= 1023.
+ */
+constexpr auto pow2(int k) noexcept -> double {
+  if (k < -1022) {
+    // subnormal: build 2^(k + 64) and scale down exactly
+    return std::bit_cast<double>(static_cast<std::uint64_t>(k + 64 + 1023) << 52) * 0x1p-64;
+  }
+  return std::bit_cast<double>(static_cast<std::uint64_t>(k + 1023) << 52);
+}
+
+/**
+ * @brief Returns e^x.
+ */
+constexpr auto exp(double x) noexcept -> double {
+  if (x > 709.78) { return std::numeric_limits<double>::infinity(); }
+  if (x < -745.2) { return 0.0; }
+
+  // x = k ln(2) + r, |r| <= ln(2) / 2
+  const auto k = static_cast<int>(x * inv_ln2 + (x < 0 ? -0.5 : 0.5));
+  const auto r = (x - k * ln2_hi) - k * ln2_lo;
+
+  // Taylor series for e^r, evaluated by Horner's rule; the truncation error is below 2^-60
+  auto p = 1.0;
+  for (int n = 17; n > 0; --n) { p = 1.0 + p * r / n; }
+
+  // scale in two steps so that intermediate values stay normal
+  return p * pow2(k / 2) * pow2(k - k / 2);
+}
+
+/**
+ * @brief Returns the natural logarithm of @a x, for finite @a x > 0.
+ */
+constexpr auto log(double x) noexcept -> double {
+  if (x <= 0.0) { return -std::numeric_limits<double>::infinity(); }
+
+  // x = m 2^e, sqrt(1/2) <= m < sqrt(2)
+  auto e = 0;
+  if (x < 0x1p-1022) {
+    x *= 0x1p64;
+    e -= 64;
+  }
+  const auto bits = std::bit_cast<std::uint64_t>(x);
+  e += static_cast<int>(bits >> 52) - 1023;
+  auto m = std::bit_cast<double>((bits & 0x000F'FFFF'FFFF'FFFFull) | 0x3FF0'0000'0000'0000ull);
+  if (m > 1.41421356237309504880) {
+    m *= 0.5;
+    ++e;
+  }
+
+  // log(m) = 2 atanh(s), s = (m - 1) / (m + 1), |s| < 0.1716
+  const auto s = (m - 1.0) / (m + 1.0);
+  const auto s2 = s * s;
+  auto p = 0.0;
+  for (int n = 25; n > 1; n -= 2) { p = (p + 1.0 / n) * s2; }
+  const auto log_m = 2.0 * s + 2.0 * s * p;
+
+  return (e * ln2_hi + log_m) + e * ln2_lo;
+}
+
+/**
+ * @brief Returns the square root of @a x, for finite @a x >= 0.
+ */
+constexpr auto sqrt(double x) noexcept -> double {
+  if (x <= 0.0) { return 0.0; }
+
+  // Start from a guess with half the exponent and refine with Newton's method. After the first
+  // step the iterates decrease monotonically, so stop as soon as they no longer do.
+  const auto bits = std::bit_cast<std::uint64_t>(x);
+  auto y = std::bit_cast<double>((bits >> 1) + (std::uint64_t{1023} << 51));
+  y = 0.5 * (y + x / y);
+  for (int i = 0; i < 64; ++i) {
+    const auto z = 0.5 * (y + x / y);
+    if (z >= y) { break; }
+    y = z;
+  }
+  return y;
+}
+
+/**
+ * @brief Returns log(k!), for k >= 0.
+ *
+ * Exact factorials are used while they fit in a double, and Stirling's series beyond that, where
+ * its truncation error is below 1e-15.
+ */
+constexpr auto log_factorial(double k) noexcept -> double {
+  if (k < 18.0) {
+    auto f = 1.0;
+    for (auto i = 2.0; i <= k; i += 1.0) { f *= i; }
+    return log(f);
+  }
+
+  // log Gamma(x) for x = k + 1
+  constexpr auto half_log_2pi = 0.91893853320467274178;
+  const auto x = k + 1.0;
+  const auto r = 1.0 / x;
+  const auto r2 = r * r;
+  const auto series = r * (1.0 / 12 - r2 * (1.0 / 360 - r2 * (1.0 / 1260 - r2 / 1680)));
+  return (x - 0.5) * log(x) - x + half_log_2pi + series;
+}
+
+}  // namespace mattsep::random::internal::math
+
+#endif
@@ -0,0 +1,366 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_INTERNAL_SIMD_HPP_INCLUDED
+#define MATTSEP_RANDOM_INTERNAL_SIMD_HPP_INCLUDED
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace mattsep::random::internal::simd {
+
+/**
+ * @brief A fixed-width vector of @a N unsigned integer lanes.
+ *
+ * The generic definition operates lane by lane on an array, which compilers readily vectorize.
+ * Explicit specializations map the common widths directly onto SSE2, AVX2 and AVX-512 registers
+ * when those instruction sets are enabled at compile time.
+ */
+template <std::unsigned_integral T, std::size_t N>
+struct vec {
+  alignas(sizeof(T) * N) std::array<T, N> lanes;
+
+  static auto load(T const* p) noexcept -> vec {
+    vec x;
+    std::copy_n(p, N, x.lanes.begin());
+    return x;
+  }
+
+  static auto broadcast(T value) noexcept -> vec {
+    vec x;
+    x.lanes.fill(value);
+    return x;
+  }
+
+  auto store(T* p) const noexcept -> void {
+    std::copy_n(lanes.begin(), N, p);
+  }
+
+  auto operator==(vec const& rhs) const noexcept -> bool = default;
+};
+
+template <class T, std::size_t N>
+auto operator+(vec<T, N> const& x, vec<T, N> const& y) noexcept -> vec<T, N> {
+  auto z = x;
+  for (std::size_t i = 0; i < N; ++i) { z.lanes[i] += y.lanes[i]; }
+  return z;
+}
+
+template <class T, std::size_t N>
+auto operator-(vec<T, N> const& x, vec<T, N> const& y) noexcept -> vec<T, N> {
+  auto z = x;
+  for (std::size_t i = 0; i < N; ++i) { z.lanes[i] -= y.lanes[i]; }
+  return z;
+}
+
+template <class T, std::size_t N>
+auto operator^(vec<T, N> const& x, vec<T, N> const& y) noexcept -> vec<T, N> {
+  auto z = x;
+  for (std::size_t i = 0; i < N; ++i) { z.lanes[i] ^= y.lanes[i]; }
+  return z;
+}
+
+template <int R, class T, std::size_t N>
+auto rotl(vec<T, N> const& x) noexcept -> vec<T, N> {
+  auto z = x;
+  for (auto& v : z.lanes) { v = std::rotl(v, R); }
+  return z;
+}
+
+template <int R, class T, std::size_t N>
+auto shl(vec<T, N> const& x) noexcept -> vec<T, N> {
+  auto z = x;
+  for (auto& v : z.lanes) { v = static_cast<T>(v << R); }
+  return z;
+}
+
+template <int R, class T, std::size_t N>
+auto shr(vec<T, N> const& x) noexcept -> vec<T, N> {
+  auto z = x;
+  for (auto& v : z.lanes) { v = static_cast<T>(v >> R); }
+  return z;
+}
+
+#if defined(__SSE2__)
+
+template <>
+struct vec<std::uint32_t, 4> {
+  __m128i v;
+
+  static auto load(std::uint32_t const* p) noexcept -> vec {
+    return {_mm_loadu_si128(reinterpret_cast<__m128i const*>(p))};
+  }
+
+  static auto broadcast(std::uint32_t value) noexcept -> vec {
+    return {_mm_set1_epi32(static_cast<int>(value))};
+  }
+
+  auto store(std::uint32_t* p) const noexcept -> void {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+  }
+
+  auto operator==(vec const& rhs) const noexcept -> bool {
+    return _mm_movemask_epi8(_mm_cmpeq_epi32(v, rhs.v)) == 0xFFFF;
+  }
+};
+
+// clang-format off
+inline auto operator+(vec<std::uint32_t, 4> x, vec<std::uint32_t, 4> const& y) noexcept -> vec<std::uint32_t, 4> { return {_mm_add_epi32(x.v, y.v)}; }
+inline auto operator-(vec<std::uint32_t, 4> x, vec<std::uint32_t, 4> const& y) noexcept -> vec<std::uint32_t, 4> { return {_mm_sub_epi32(x.v, y.v)}; }
+inline auto operator^(vec<std::uint32_t, 4> x, vec<std::uint32_t, 4> const& y) noexcept -> vec<std::uint32_t, 4> { return {_mm_xor_si128(x.v, y.v)}; }
+// clang-format on
+
+template <int R>
+auto shl(vec<std::uint32_t, 4> x) noexcept -> vec<std::uint32_t, 4> {
+  return {_mm_slli_epi32(x.v, R)};
+}
+
+template <int R>
+auto shr(vec<std::uint32_t, 4> x) noexcept -> vec<std::uint32_t, 4> {
+  return {_mm_srli_epi32(x.v, R)};
+}
+
+template <int R>
+auto rotl(vec<std::uint32_t, 4> x) noexcept -> vec<std::uint32_t, 4> {
+#if defined(__AVX512VL__)
+  return {_mm_rol_epi32(x.v, R)};
+#else
+  if constexpr (R == 16) {
+    // swapping the 16-bit halves of each lane takes two word shuffles
+    return {_mm_shufflehi_epi16(_mm_shufflelo_epi16(x.v, 0xB1), 0xB1)};
+  } else {
+    // SSE2 has no byte shuffle, so rotating by 8 (or any other amount) stays shift/or
+    return {_mm_or_si128(_mm_slli_epi32(x.v, R), _mm_srli_epi32(x.v, 32 - R))};
+  }
+#endif
+}
+
+#endif  // __SSE2__
+
+#if defined(__AVX2__)
+
+template <>
+struct vec<std::uint64_t, 4> {
+  __m256i v;
+
+  static auto load(std::uint64_t const* p) noexcept -> vec {
+    return {_mm256_loadu_si256(reinterpret_cast<__m256i const*>(p))};
+  }
+
+  static auto broadcast(std::uint64_t value) noexcept -> vec {
+    return {_mm256_set1_epi64x(static_cast<long long>(value))};
+  }
+
+  auto store(std::uint64_t* p) const noexcept -> void {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+  }
+
+  auto operator==(vec const& rhs) const noexcept -> bool {
+    return _mm256_movemask_epi8(_mm256_cmpeq_epi64(v, rhs.v)) == -1;
+  }
+};
+
+template <>
+struct vec<std::uint32_t, 8> {
+  __m256i v;
+
+  static auto load(std::uint32_t const* p) noexcept -> vec {
+    return {_mm256_loadu_si256(reinterpret_cast<__m256i const*>(p))};
+  }
+
+  static auto broadcast(std::uint32_t value) noexcept -> vec {
+    return {_mm256_set1_epi32(static_cast<int>(value))};
+  }
+
+  auto store(std::uint32_t* p) const noexcept -> void {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+  }
+
+  auto operator==(vec const& rhs) const noexcept -> bool {
+    return _mm256_movemask_epi8(_mm256_cmpeq_epi32(v, rhs.v)) == -1;
+  }
+};
+
+// clang-format off
+inline auto operator+(vec<std::uint64_t, 4> x, vec<std::uint64_t, 4> const& y) noexcept -> vec<std::uint64_t, 4> { return {_mm256_add_epi64(x.v, y.v)}; }
+inline auto operator-(vec<std::uint64_t, 4> x, vec<std::uint64_t, 4> const& y) noexcept -> vec<std::uint64_t, 4> { return {_mm256_sub_epi64(x.v, y.v)}; }
+inline auto operator^(vec<std::uint64_t, 4> x, vec<std::uint64_t, 4> const& y) noexcept -> vec<std::uint64_t, 4> { return {_mm256_xor_si256(x.v, y.v)}; }
+inline auto operator+(vec<std::uint32_t, 8> x, vec<std::uint32_t, 8> const& y) noexcept -> vec<std::uint32_t, 8> { return {_mm256_add_epi32(x.v, y.v)}; }
+inline auto operator-(vec<std::uint32_t, 8> x, vec<std::uint32_t, 8> const& y) noexcept -> vec<std::uint32_t, 8> { return {_mm256_sub_epi32(x.v, y.v)}; }
+inline auto operator^(vec<std::uint32_t, 8> x, vec<std::uint32_t, 8> const& y) noexcept -> vec<std::uint32_t, 8> { return {_mm256_xor_si256(x.v, y.v)}; }
+// clang-format on
+
+template <int R>
+auto shl(vec<std::uint64_t, 4> x) noexcept -> vec<std::uint64_t, 4> {
+  return {_mm256_slli_epi64(x.v, R)};
+}
+
+template <int R>
+auto shr(vec<std::uint64_t, 4> x) noexcept -> vec<std::uint64_t, 4> {
+  return {_mm256_srli_epi64(x.v, R)};
+}
+
+template <int R>
+auto rotl(vec<std::uint64_t, 4> x) noexcept -> vec<std::uint64_t, 4> {
+#if defined(__AVX512VL__)
+  return {_mm256_rol_epi64(x.v, R)};
+#else
+  return {_mm256_or_si256(_mm256_slli_epi64(x.v, R), _mm256_srli_epi64(x.v, 64 - R))};
+#endif
+}
+
+template <int R>
+auto shl(vec<std::uint32_t, 8> x) noexcept -> vec<std::uint32_t, 8> {
+  return {_mm256_slli_epi32(x.v, R)};
+}
+
+template <int R>
+auto shr(vec<std::uint32_t, 8> x) noexcept -> vec<std::uint32_t, 8> {
+  return {_mm256_srli_epi32(x.v, R)};
+}
+
+template <int R>
+auto rotl(vec<std::uint32_t, 8> x) noexcept -> vec<std::uint32_t, 8> {
+#if defined(__AVX512VL__)
+  return {_mm256_rol_epi32(x.v, R)};
+#else
+  // rotations by whole bytes are a single byte shuffle
+  if constexpr (R == 8) {
+    const auto order = _mm256_setr_epi8(3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14, 3, 0,
+                                        1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14);
+    return {_mm256_shuffle_epi8(x.v, order)};
+  } else if constexpr (R == 16) {
+    const auto order = _mm256_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13, 2, 3,
+                                        0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+    return {_mm256_shuffle_epi8(x.v, order)};
+  } else {
+    return {_mm256_or_si256(_mm256_slli_epi32(x.v, R), _mm256_srli_epi32(x.v, 32 - R))};
+  }
+#endif
+}
+
+#endif  // __AVX2__
+
+#if defined(__AVX512F__)
+
+// The shifts and rotations below use the zero-masking forms with a full mask. They compile to the
+// same instructions, but avoid spurious -Wuninitialized diagnostics from GCC 12's headers for the
+// unmasked forms.
+
+template <>
+struct vec<std::uint64_t, 8> {
+  __m512i v;
+
+  static auto load(std::uint64_t const* p) noexcept -> vec {
+    return {_mm512_loadu_si512(p)};
+  }
+
+  static auto broadcast(std::uint64_t value) noexcept -> vec {
+    return {_mm512_set1_epi64(static_cast<long long>(value))};
+  }
+
+  auto store(std::uint64_t* p) const noexcept -> void {
+    _mm512_storeu_si512(p, v);
+  }
+
+  auto operator==(vec const& rhs) const noexcept -> bool {
+    return _mm512_cmpeq_epi64_mask(v, rhs.v) == 0xFF;
+  }
+};
+
+template <>
+struct vec<std::uint32_t, 16> {
+  __m512i v;
+
+  static auto load(std::uint32_t const* p) noexcept -> vec {
+    return {_mm512_loadu_si512(p)};
+  }
+
+  static auto broadcast(std::uint32_t value) noexcept -> vec {
+    return {_mm512_set1_epi32(static_cast<int>(value))};
+  }
+
+  auto store(std::uint32_t* p) const noexcept -> void {
+    _mm512_storeu_si512(p, v);
+  }
+
+  auto operator==(vec const& rhs) const noexcept -> bool {
+    return _mm512_cmpeq_epi32_mask(v, rhs.v) == 0xFFFF;
+  }
+};
+
+// clang-format off
+inline auto operator+(vec<std::uint64_t, 8> x, vec<std::uint64_t, 8> const& y) noexcept -> vec<std::uint64_t, 8> { return {_mm512_add_epi64(x.v, y.v)}; }
+inline auto operator-(vec<std::uint64_t, 8> x, vec<std::uint64_t, 8> const& y) noexcept -> vec<std::uint64_t, 8> { return {_mm512_sub_epi64(x.v, y.v)}; }
+inline auto operator^(vec<std::uint64_t, 8> x, vec<std::uint64_t, 8> const& y) noexcept -> vec<std::uint64_t, 8> { return {_mm512_xor_si512(x.v, y.v)}; }
+inline auto operator+(vec<std::uint32_t, 16> x, vec<std::uint32_t, 16> const& y) noexcept -> vec<std::uint32_t, 16> { return {_mm512_add_epi32(x.v, y.v)}; }
+inline auto operator-(vec<std::uint32_t, 16> x, vec<std::uint32_t, 16> const& y) noexcept -> vec<std::uint32_t, 16> { return {_mm512_sub_epi32(x.v, y.v)}; }
+inline auto operator^(vec<std::uint32_t, 16> x, vec<std::uint32_t, 16> const& y) noexcept -> vec<std::uint32_t, 16> { return {_mm512_xor_si512(x.v, y.v)}; }
+// clang-format on
+
+template <int R>
+auto shl(vec<std::uint64_t, 8> x) noexcept -> vec<std::uint64_t, 8> {
+  return {_mm512_maskz_slli_epi64(0xFF, x.v, R)};
+}
+
+template <int R>
+auto shr(vec<std::uint64_t, 8> x) noexcept -> vec<std::uint64_t, 8> {
+  return {_mm512_maskz_srli_epi64(0xFF, x.v, R)};
+}
+
+template <int R>
+auto rotl(vec<std::uint64_t, 8> x) noexcept -> vec<std::uint64_t, 8> {
+  return {_mm512_maskz_rol_epi64(0xFF, x.v, R)};
+}
+
+template <int R>
+auto shl(vec<std::uint32_t, 16> x) noexcept -> vec<std::uint32_t, 16> {
+  return {_mm512_maskz_slli_epi32(0xFFFF, x.v, R)};
+}
+
+template <int R>
+auto shr(vec<std::uint32_t, 16> x) noexcept -> vec<std::uint32_t, 16> {
+  return {_mm512_maskz_srli_epi32(0xFFFF, x.v, R)};
+}
+
+template <int R>
+auto rotl(vec<std::uint32_t, 16> x) noexcept -> vec<std::uint32_t, 16> {
+  return {_mm512_maskz_rol_epi32(0xFFFF, x.v, R)};
+}
+
+#endif  // __AVX512F__
+
+}  // namespace mattsep::random::internal::simd
+
+#endif
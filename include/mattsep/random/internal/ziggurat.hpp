@@ -0,0 +1,113 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_INTERNAL_ZIGGURAT_HPP_INCLUDED
+#define MATTSEP_RANDOM_INTERNAL_ZIGGURAT_HPP_INCLUDED
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#include "mattsep/random/internal/math.hpp"
+
+namespace mattsep::random::internal::ziggurat {
+
+inline constexpr std::size_t layers = 256;
+
+/**
+ * @brief The layer boundaries of a 256-layer ziggurat and the density at each of them.
+ *
+ * `x[0]` is the width of a rectangle with the same area as the base layer (which includes the
+ * tail), `x[1]` is the start of the tail, and `x[256]` is zero. `f[i]` is the unnormalized density
+ * at `x[i]`.
+ */
+struct table {
+  std::array<double, layers + 1> x;
+  std::array<double, layers + 1> f;
+};
+
+/**
+ * @brief Builds the table for a decreasing density @a pdf with inverse @a inverse_pdf.
+ *
+ * @param r The start of the tail
+ * @param v The common area of every layer
+ */
+template <class Pdf, class InversePdf>
+constexpr auto make_table(double r, double v, Pdf pdf, InversePdf inverse_pdf) -> table {
+  auto t = table{};
+  t.x[0] = v / pdf(r);
+  t.x[1] = r;
+  for (std::size_t i = 2; i < layers; ++i) { t.x[i] = inverse_pdf(v / t.x[i - 1] + pdf(t.x[i - 1])); }
+  t.x[layers] = 0.0;
+
+  for (std::size_t i = 0; i <= layers; ++i) { t.f[i] = pdf(t.x[i]); }
+  return t;
+}
+
+inline constexpr double normal_r = 3.6541528853610088;
+inline constexpr double normal_v = 0.00492867323399;
+
+inline constexpr double exponential_r = 7.69711747013104972;
+inline constexpr double exponential_v = 0.0039496598225815571993;
+
+constexpr auto normal_pdf(double x) -> double {
+  return math::exp(-0.5 * x * x);
+}
+
+constexpr auto exponential_pdf(double x) -> double {
+  return math::exp(-x);
+}
+
+inline constexpr auto normal = make_table(normal_r, normal_v, normal_pdf, [](double y) {
+  return math::sqrt(-2.0 * math::log(y));
+});
+
+inline constexpr auto exponential = make_table(exponential_r, exponential_v, exponential_pdf,
+                                               [](double y) { return -math::log(y); });
+
+/**
+ * @brief Maps the top 53 bits of @a bits to a double in [0, 1).
+ */
+constexpr auto unit(std::uint64_t bits) -> double {
+  return static_cast<double>(bits >> 11) * 0x1p-53;
+}
+
+/**
+ * @brief Maps the top 52 bits of @a bits to a double in the open interval (0, 1).
+ */
+constexpr auto open_unit(std::uint64_t bits) -> double {
+  return (static_cast<double>(bits >> 12) + 0.5) * 0x1p-52;
+}
+
+/**
+ * @brief Maps the top 52 bits of @a bits to a double in [-1, 1).
+ */
+constexpr auto signed_unit(std::uint64_t bits) -> double {
+  return std::bit_cast<double>((bits >> 12) | 0x4000'0000'0000'0000ull) - 3.0;
+}
+
+}  // namespace mattsep::random::internal::ziggurat
+
+#endif
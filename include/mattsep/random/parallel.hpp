@@ -0,0 +1,92 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_PARALLEL_HPP_INCLUDED
+#define MATTSEP_RANDOM_PARALLEL_HPP_INCLUDED
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <execution>
+#include <numeric>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "mattsep/random/concepts.hpp"
+#include "mattsep/random/distributions.hpp"
+#include "mattsep/random/engines.hpp"
+#include "mattsep/random/internal.hpp"
+
+namespace mattsep::random {
+
+/**
+ * @brief The number of elements generated from each stream by `parallel_fill`.
+ *
+ * This is part of the output format: changing it changes the values `parallel_fill` produces.
+ */
+inline constexpr std::size_t parallel_fill_chunk_size = std::size_t{1} << 16;
+
+/**
+ * @brief Fills @a out with values from @a dist, spreading the work according to @a policy.
+ *
+ * The output is cut into chunks of `parallel_fill_chunk_size` elements, and chunk `k` is generated
+ * by a fresh `Engine{seed, k}` using its own copy of @a dist. Since the chunk-to-stream mapping
+ * does not depend on how chunks are scheduled, the result is bit-identical for every execution
+ * policy and thread count.
+ *
+ * @tparam Engine An engine constructible from a seed and a stream id
+ * @param policy A standard execution policy, e.g. `std::execution::par`
+ * @param out The elements to fill
+ * @param seed The seed shared by every stream
+ * @param dist The distribution to draw from
+ */
+template <uniform_random_bit_generator Engine = default_random_engine, class ExecutionPolicy,
+          class T, class Distribution = distributions::uniform<T>>
+requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    && std::constructible_from<Engine, typename Engine::result_type, typename Engine::result_type>
+auto parallel_fill(ExecutionPolicy&& policy, std::span<T> out, typename Engine::result_type seed,
+                   Distribution const& dist = {}) -> void {
+  using result_type = typename Engine::result_type;
+
+  // Parallel algorithms need forward iterators, so the chunk ids are materialized rather than
+  // taken from an iota view.
+  auto chunks = std::vector<std::size_t>(
+      (out.size() + parallel_fill_chunk_size - 1) / parallel_fill_chunk_size);
+  std::iota(chunks.begin(), chunks.end(), std::size_t{0});
+
+  std::for_each(std::forward<ExecutionPolicy>(policy), chunks.begin(), chunks.end(),
+                [&](std::size_t k) {
+                  const auto offset = k * parallel_fill_chunk_size;
+                  const auto count = std::min(parallel_fill_chunk_size, out.size() - offset);
+
+                  auto engine = Engine{seed, static_cast<result_type>(k)};
+                  auto d = dist;
+                  internal::generate(d, engine, out.subspan(offset, count));
+                });
+}
+
+}  // namespace mattsep::random
+
+#endif
@@ -0,0 +1,513 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_QUALITY_HPP_INCLUDED
+#define MATTSEP_RANDOM_QUALITY_HPP_INCLUDED
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "mattsep/random/concepts.hpp"
+#include "mattsep/random/internal.hpp"
+
+namespace mattsep::random::quality {
+
+/**
+ * @brief The outcome of one statistical test.
+ *
+ * Under the hypothesis that the engine is random, `p_value` is uniform on [0, 1]; values very close
+ * to 0 or to 1 are evidence against the engine.
+ */
+struct result {
+  std::string name;
+  double statistic = 0.0;
+  double p_value = 0.0;
+};
+
+struct options {
+  /// The number of 64-bit words each test consumes, summed over all threads.
+  std::uint64_t words = std::uint64_t{1} << 24;
+
+  /// The number of threads, each drawing from its own stream; 0 uses every hardware thread.
+  unsigned threads = 0;
+};
+
+/**
+ * @brief Classifies @a p as "pass", "weak" (outside [1e-3, 1 - 1e-3]) or "FAIL" (outside
+ * [1e-6, 1 - 1e-6]).
+ */
+inline auto assess(double p) -> std::string_view {
+  const auto tail = std::min(p, 1.0 - p);
+  if (!(tail >= 1e-6)) { return "FAIL"; }
+  if (tail < 1e-3) { return "weak"; }
+  return "pass";
+}
+
+/**
+ * @brief Returns the regularized upper incomplete gamma function Q(a, x).
+ *
+ * Uses the power series of P(a, x) below x = a + 1 and Lentz's continued fraction above it.
+ */
+inline auto gamma_q(double a, double x) -> double {
+  constexpr auto epsilon = std::numeric_limits<double>::epsilon();
+  constexpr auto tiny = std::numeric_limits<double>::min() / epsilon;
+
+  if (!(x > 0.0)) { return 1.0; }
+  const auto front = std::exp(-x + a * std::log(x) - std::lgamma(a));
+
+  if (x < a + 1.0) {
+    auto term = 1.0 / a;
+    auto sum = term;
+    for (int n = 1; n < 1000 && std::abs(term) > std::abs(sum) * epsilon; ++n) {
+      term *= x / (a + n);
+      sum += term;
+    }
+    return std::max(0.0, 1.0 - sum * front);
+  }
+
+  auto b = x + 1.0 - a;
+  auto c = 1.0 / tiny;
+  auto d = 1.0 / b;
+  auto h = d;
+  for (int i = 1; i < 1000; ++i) {
+    const auto an = -i * (i - a);
+    b += 2.0;
+    d = an * d + b;
+    if (std::abs(d) < tiny) { d = tiny; }
+    c = b + an / c;
+    if (std::abs(c) < tiny) { c = tiny; }
+    d = 1.0 / d;
+    const auto delta = d * c;
+    h *= delta;
+    if (std::abs(delta - 1.0) <= epsilon) { break; }
+  }
+  return front * h;
+}
+
+/**
+ * @brief Returns the probability that a chi-square variable with @a dof degrees of freedom exceeds
+ * @a x.
+ */
+inline auto chi_square_p(double x, double dof) -> double {
+  return gamma_q(0.5 * dof, 0.5 * x);
+}
+
+/**
+ * @brief Returns the two-sided p-value of a standard normal statistic @a z.
+ */
+inline auto normal_p(double z) -> double {
+  return std::erfc(std::abs(z) / std::sqrt(2.0));
+}
+
+/**
+ * @brief Returns Pearson's statistic for @a observed counts against @a expected probabilities.
+ */
+inline auto chi_square(std::span<std::uint64_t const> observed, std::span<double const> expected)
+    -> double {
+  auto total = 0.0;
+  for (auto x : observed) { total += static_cast<double>(x); }
+
+  auto statistic = 0.0;
+  for (std::size_t i = 0; i < observed.size(); ++i) {
+    const auto e = total * expected[i];
+    const auto d = static_cast<double>(observed[i]) - e;
+    statistic += d * d / e;
+  }
+  return statistic;
+}
+
+/*
+ * Each test below is a struct with a `counts` type, a `sample` function that draws `words` words
+ * from one stream and tallies them, a `merge` of two tallies and an `evaluate` step that turns the
+ * combined tally into a `result`. This split lets every test run on many streams at once.
+ */
+namespace tests {
+
+  namespace detail {
+    // Words are processed in blocks so that engines with a bulk path can use it.
+    inline constexpr std::size_t block_size = 4096;
+
+    template <uniform_random_bit_generator G, class F>
+    auto for_each_block(G& g, std::uint64_t words, F&& f) -> void {
+      auto block = std::vector<std::uint64_t>(block_size);
+      while (words > 0) {
+        const auto n = static_cast<std::size_t>(std::min<std::uint64_t>(words, block_size));
+        const auto out = std::span{block}.first(n);
+        internal::generate_words(g, out);
+        f(std::span<std::uint64_t const>{out});
+        words -= n;
+      }
+    }
+
+    template <std::size_t N>
+    auto merge(std::array<std::uint64_t, N>& into, std::array<std::uint64_t, N> const& from)
+        -> void {
+      for (std::size_t i = 0; i < N; ++i) { into[i] += from[i]; }
+    }
+  }  // namespace detail
+
+  /**
+   * @brief The proportion of one bits.
+   */
+  struct monobit {
+    struct counts {
+      std::uint64_t ones = 0;
+      std::uint64_t words = 0;
+    };
+
+    template <uniform_random_bit_generator G>
+    static auto sample(G& g, std::uint64_t words) -> counts {
+      auto c = counts{};
+      detail::for_each_block(g, words, [&](auto block) {
+        for (auto w : block) { c.ones += static_cast<std::uint64_t>(std::popcount(w)); }
+        c.words += block.size();
+      });
+      return c;
+    }
+
+    static auto merge(counts& into, counts const& from) -> void {
+      into.ones += from.ones;
+      into.words += from.words;
+    }
+
+    static auto evaluate(counts const& c) -> result {
+      const auto n = static_cast<double>(c.words);
+      const auto z = (static_cast<double>(c.ones) - 32.0 * n) / std::sqrt(16.0 * n);
+      return {"frequency (bits)", z, normal_p(z)};
+    }
+  };
+
+  /**
+   * @brief The frequency of each byte value.
+   */
+  struct byte_frequency {
+    using counts = std::array<std::uint64_t, 256>;
+
+    template <uniform_random_bit_generator G>
+    static auto sample(G& g, std::uint64_t words) -> counts {
+      auto c = counts{};
+      detail::for_each_block(g, words, [&](auto block) {
+        for (auto w : block) {
+          for (int i = 0; i < 64; i += 8) { ++c[(w >> i) & 0xFF]; }
+        }
+      });
+      return c;
+    }
+
+    static auto merge(counts& into, counts const& from) -> void {
+      detail::merge(into, from);
+    }
+
+    static auto evaluate(counts const& c) -> result {
+      auto expected = std::array<double, 256>{};
+      expected.fill(1.0 / 256.0);
+      const auto x = chi_square(c, expected);
+      return {"frequency (bytes)", x, chi_square_p(x, 255)};
+    }
+  };
+
+  /**
+   * @brief Knuth's gap test: the distances between words whose top four bits are all zero.
+   */
+  struct gap {
+    static constexpr std::size_t lengths = 48;
+    using counts = std::array<std::uint64_t, lengths + 1>;
+
+    template <uniform_random_bit_generator G>
+    static auto sample(G& g, std::uint64_t words) -> counts {
+      auto c = counts{};
+      auto length = std::size_t{0};
+      auto started = false;
+      detail::for_each_block(g, words, [&](auto block) {
+        for (auto w : block) {
+          if ((w >> 60) == 0) {
+            if (started) { ++c[std::min(length, lengths)]; }
+            started = true;
+            length = 0;
+          } else {
+            ++length;
+          }
+        }
+      });
+      return c;
+    }
+
+    static auto merge(counts& into, counts const& from) -> void {
+      detail::merge(into, from);
+    }
+
+    static auto evaluate(counts const& c) -> result {
+      constexpr auto p = 1.0 / 16.0;
+      auto expected = std::array<double, lengths + 1>{};
+      auto q = 1.0;
+      for (std::size_t k = 0; k < lengths; ++k) {
+        expected[k] = p * q;
+        q *= 1.0 - p;
+      }
+      expected[lengths] = q;
+      const auto x = chi_square(c, expected);
+      return {"gap", x, chi_square_p(x, lengths)};
+    }
+  };
+
+  /**
+   * @brief Marsaglia's birthday spacings test on 24 bits of each word.
+   *
+   * Each trial sorts 512 birthdays in a year of 2^24 days and counts the repeated spacings, which
+   * are approximately Poisson with mean 2.
+   *
+   * @tparam Shift The position of the lowest of the 24 bits used
+   */
+  template <int Shift>
+  struct birthday_spacings {
+    static constexpr std::size_t birthdays = 512;
+    static constexpr std::size_t categories = 7;
+    using counts = std::array<std::uint64_t, categories>;
+
+    template <uniform_random_bit_generator G>
+    static auto sample(G& g, std::uint64_t words) -> counts {
+      auto c = counts{};
+      auto days = std::vector<std::uint32_t>(birthdays);
+      auto spacings = std::vector<std::uint32_t>(birthdays);
+      auto block = std::vector<std::uint64_t>(birthdays);
+
+      for (auto trials = words / birthdays; trials > 0; --trials) {
+        internal::generate_words(g, block);
+        for (std::size_t i = 0; i < birthdays; ++i) {
+          days[i] = static_cast<std::uint32_t>((block[i] >> Shift) & 0xFF'FFFF);
+        }
+        std::sort(days.begin(), days.end());
+        spacings[0] = days[0];
+        for (std::size_t i = 1; i < birthdays; ++i) { spacings[i] = days[i] - days[i - 1]; }
+        std::sort(spacings.begin(), spacings.end());
+
+        auto repeats = std::size_t{0};
+        for (std::size_t i = 1; i < birthdays; ++i) {
+          if (spacings[i] == spacings[i - 1]) { ++repeats; }
+        }
+        ++c[std::min(repeats, categories - 1)];
+      }
+      return c;
+    }
+
+    static auto merge(counts& into, counts const& from) -> void {
+      detail::merge(into, from);
+    }
+
+    static auto evaluate(counts const& c) -> result {
+      constexpr auto lambda = 2.0;
+      auto expected = std::array<double, categories>{};
+      auto term = std::exp(-lambda);
+      auto rest = 1.0;
+      for (std::size_t k = 0; k + 1 < categories; ++k) {
+        expected[k] = term;
+        rest -= term;
+        term *= lambda / static_cast<double>(k + 1);
+      }
+      expected[categories - 1] = rest;
+
+      const auto x = chi_square(c, expected);
+      auto name = Shift == 0 ? "birthday spacings (low bits)" : "birthday spacings (high bits)";
+      return {name, x, chi_square_p(x, categories - 1)};
+    }
+  };
+
+  /**
+   * @brief The rank over GF(2) of 64x64 bit matrices, one word per row.
+   */
+  struct matrix_rank {
+    static constexpr int n = 64;
+    // ranks 64, 63, 62 and at most 61
+    using counts = std::array<std::uint64_t, 4>;
+
+    static auto rank(std::span<std::uint64_t> rows) -> int {
+      auto r = 0;
+      for (int col = n - 1; col >= 0 && r < n; --col) {
+        const auto bit = std::uint64_t{1} << col;
+        auto pivot = static_cast<std::size_t>(r);
+        while (pivot < rows.size() && (rows[pivot] & bit) == 0) { ++pivot; }
+        if (pivot == rows.size()) { continue; }
+
+        std::swap(rows[pivot], rows[static_cast<std::size_t>(r)]);
+        for (auto i = static_cast<std::size_t>(r) + 1; i < rows.size(); ++i) {
+          if ((rows[i] & bit) != 0) { rows[i] ^= rows[static_cast<std::size_t>(r)]; }
+        }
+        ++r;
+      }
+      return r;
+    }
+
+    template <uniform_random_bit_generator G>
+    static auto sample(G& g, std::uint64_t words) -> counts {
+      auto c = counts{};
+      auto rows = std::array<std::uint64_t, n>{};
+      for (auto trials = words / n; trials > 0; --trials) {
+        internal::generate_words(g, rows);
+        ++c[static_cast<std::size_t>(std::min(n - rank(rows), 3))];
+      }
+      return c;
+    }
+
+    static auto merge(counts& into, counts const& from) -> void {
+      detail::merge(into, from);
+    }
+
+    /**
+     * @brief Returns the probability that a random n x n matrix over GF(2) has rank @a r.
+     */
+    static auto probability(int r) -> double {
+      auto log2p = static_cast<double>(r * (2 * n - r) - n * n);
+      for (int i = 0; i < r; ++i) {
+        const auto a = 1.0 - std::exp2(i - n);
+        log2p += 2.0 * std::log2(a) - std::log2(1.0 - std::exp2(i - r));
+      }
+      return std::exp2(log2p);
+    }
+
+    static auto evaluate(counts const& c) -> result {
+      auto expected = std::array<double, 4>{probability(n), probability(n - 1), probability(n - 2)};
+      expected[3] = 1.0 - expected[0] - expected[1] - expected[2];
+      const auto x = chi_square(c, expected);
+      return {"matrix rank (64x64)", x, chi_square_p(x, 3)};
+    }
+  };
+
+  /**
+   * @brief The correlation between the Hamming weights of consecutive words.
+   */
+  struct hamming_correlation {
+    struct counts {
+      double sum = 0.0;
+      std::uint64_t pairs = 0;
+    };
+
+    template <uniform_random_bit_generator G>
+    static auto sample(G& g, std::uint64_t words) -> counts {
+      auto c = counts{};
+      auto first = true;
+      auto previous = 0;
+      auto sum = std::int64_t{0};
+      detail::for_each_block(g, words, [&](auto block) {
+        for (auto w : block) {
+          const auto weight = std::popcount(w) - 32;
+          if (!first) {
+            sum += std::int64_t{previous} * weight;
+            ++c.pairs;
+          }
+          first = false;
+          previous = weight;
+        }
+      });
+      // each product has variance 16 * 16
+      c.sum = static_cast<double>(sum) / 16.0;
+      return c;
+    }
+
+    static auto merge(counts& into, counts const& from) -> void {
+      into.sum += from.sum;
+      into.pairs += from.pairs;
+    }
+
+    static auto evaluate(counts const& c) -> result {
+      const auto z = c.sum / std::sqrt(static_cast<double>(c.pairs));
+      return {"hamming weight correlation", z, normal_p(z)};
+    }
+  };
+
+}  // namespace tests
+
+/**
+ * @brief Runs @a Test on every stream in parallel and evaluates the combined tally.
+ */
+template <class Test, uniform_random_bit_generator Engine>
+auto run_test(std::span<Engine> streams, std::uint64_t words) -> result {
+  auto partial = std::vector<typename Test::counts>(streams.size());
+  const auto share = words / streams.size();
+  {
+    auto threads = std::vector<std::jthread>{};
+    threads.reserve(streams.size());
+    for (std::size_t i = 0; i < streams.size(); ++i) {
+      threads.emplace_back([&, i] { partial[i] = Test::sample(streams[i], share); });
+    }
+  }
+
+  auto total = partial[0];
+  for (std::size_t i = 1; i < partial.size(); ++i) { Test::merge(total, partial[i]); }
+  return Test::evaluate(total);
+}
+
+/**
+ * @brief Runs the full battery on streams derived from @a engine.
+ *
+ * Each thread draws from its own stream, split off @a engine (or, for engines without `split`,
+ * seeded from its output), so the results are reproducible for a given engine, word count and
+ * thread count.
+ */
+template <uniform_random_bit_generator Engine>
+auto run(Engine const& engine, options const& opts = {}) -> std::vector<result> {
+  using result_type = typename Engine::result_type;
+  auto source = engine;
+
+  auto threads = opts.threads != 0 ? opts.threads : std::thread::hardware_concurrency();
+  threads = std::max(threads, 1u);
+
+  auto streams = std::vector<Engine>{};
+  streams.reserve(threads);
+  for (unsigned i = 0; i < threads; ++i) {
+    if constexpr (requires { source.split(); }) {
+      streams.push_back(source.split());
+    } else {
+      static_assert(std::constructible_from<Engine, result_type>,
+                    "quality::run requires an engine with split() or a single-word seed");
+      streams.push_back(Engine{internal::mix(static_cast<result_type>(source()))});
+    }
+  }
+
+  const auto s = std::span{streams};
+  return {
+      run_test<tests::monobit>(s, opts.words),
+      run_test<tests::byte_frequency>(s, opts.words),
+      run_test<tests::gap>(s, opts.words),
+      run_test<tests::birthday_spacings<40>>(s, opts.words),
+      run_test<tests::birthday_spacings<0>>(s, opts.words),
+      run_test<tests::matrix_rank>(s, opts.words),
+      run_test<tests::hamming_correlation>(s, opts.words),
+  };
+}
+
+}  // namespace mattsep::random::quality
+
+#endif
@@ -0,0 +1,212 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_QUASI_HALTON_HPP_INCLUDED
+#define MATTSEP_RANDOM_QUASI_HALTON_HPP_INCLUDED
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "mattsep/random/internal.hpp"
+
+namespace mattsep::random::quasi {
+
+/**
+ * @brief A Halton sequence, whose dimension j is the radical inverse of the index in the j-th
+ * prime base.
+ *
+ * Each dimension keeps the digits of the index and their reversal as an exact integer, so the next
+ * point costs one digit increment per dimension, amortized, and `seek` jumps to any index in
+ * O(d log n) operations. Threads can therefore take disjoint ranges of indices from copies of one
+ * sequence.
+ *
+ * Halton points need no table and exist in any number of dimensions, but the larger bases are
+ * strongly correlated with one another in short runs of points; prefer `sobol` past a few dozen
+ * dimensions.
+ */
+class halton {
+public:
+  using value_type = double;
+
+  /**
+   * @brief Creates the sequence in @a dimensions dimensions, starting at index 0.
+   */
+  explicit halton(std::size_t dimensions) : axes_(dimensions) {
+    if (dimensions == 0) { throw std::invalid_argument("halton: dimensions must be positive"); }
+
+    auto base = std::uint32_t{1};
+    auto offset = std::size_t{0};
+    for (auto& a : axes_) {
+      base = next_prime(base);
+      a.base = base;
+      a.offset = offset;
+
+      // Enough digits for every 64-bit index, so b^digits >= 2^64.
+      auto whole = internal::uint128_t{1};
+      while (whole >> 64 == 0) {
+        whole *= base;
+        ++a.digits;
+      }
+      a.scale = 1.0 / static_cast<double>(whole);
+      offset += a.digits;
+    }
+
+    digits_.resize(offset);
+    powers_.resize(offset);
+    for (auto const& a : axes_) {
+      auto power = internal::uint128_t{1};
+      for (std::size_t k = a.digits; k-- != 0;) {
+        powers_[a.offset + k] = power;
+        power *= a.base;
+      }
+    }
+  }
+
+  [[nodiscard]] auto dimensions() const noexcept -> std::size_t {
+    return axes_.size();
+  }
+
+  /**
+   * @brief Returns the base of dimension @a j, the (j + 1)-th prime.
+   */
+  [[nodiscard]] auto base(std::size_t j) const noexcept -> std::uint32_t {
+    return axes_[j].base;
+  }
+
+  /**
+   * @brief Returns the index of the next point.
+   */
+  [[nodiscard]] auto index() const noexcept -> std::uint64_t {
+    return index_;
+  }
+
+  /**
+   * @brief Moves to the point at @a index, so that it is the next one output.
+   */
+  auto seek(std::uint64_t index) noexcept -> void {
+    for (auto& a : axes_) {
+      auto n = index;
+      a.reversed = 0;
+      for (std::size_t k = 0; k < a.digits; ++k) {
+        const auto d = static_cast<std::uint32_t>(n % a.base);
+        n /= a.base;
+        digits_[a.offset + k] = d;
+        a.reversed += d * powers_[a.offset + k];
+      }
+    }
+    index_ = index;
+  }
+
+  auto discard(std::uint64_t n) noexcept -> void {
+    seek(index_ + n);
+  }
+
+  /**
+   * @brief Writes the next point to @a point, which must have one element per dimension.
+   */
+  auto next(std::span<double> point) -> void {
+    if (point.size() != axes_.size()) {
+      throw std::invalid_argument("halton: the point must have one element per dimension");
+    }
+    for (std::size_t j = 0; j < axes_.size(); ++j) {
+      point[j] = to_unit(axes_[j]);
+      increment(axes_[j]);
+    }
+    ++index_;
+  }
+
+  /**
+   * @brief Fills @a out with the next `n = out.size() / dimensions()` points, one dimension after
+   * another: coordinate j of the i-th point is `out[j * n + i]`.
+   *
+   * The size of @a out must be a multiple of the number of dimensions.
+   */
+  auto generate(std::span<double> out) -> void {
+    if (out.size() % axes_.size() != 0) {
+      throw std::invalid_argument("halton: the output must hold a whole number of points");
+    }
+    const auto n = out.size() / axes_.size();
+    for (std::size_t j = 0; j < axes_.size(); ++j) {
+      auto& a = axes_[j];
+      for (auto& u : out.subspan(j * n, n)) {
+        u = to_unit(a);
+        increment(a);
+      }
+    }
+    index_ += n;
+  }
+
+private:
+  struct axis {
+    std::uint32_t base = 0;
+    std::size_t digits = 0;
+    std::size_t offset = 0;
+    double scale = 0.0;
+    // The digits of the index reversed about the point, as an integer below b^digits.
+    internal::uint128_t reversed = 0;
+  };
+
+  std::vector<axis> axes_;
+  // Digit k of the index in dimension j, least significant first, is at axes_[j].offset + k, next
+  // to the power b^(digits - 1 - k) it is weighted by in the radical inverse.
+  std::vector<std::uint32_t> digits_;
+  std::vector<internal::uint128_t> powers_;
+  std::uint64_t index_ = 0;
+
+  auto increment(axis& a) noexcept -> void {
+    auto* d = digits_.data() + a.offset;
+    auto const* p = powers_.data() + a.offset;
+    for (std::size_t k = 0; k < a.digits; ++k) {
+      if (d[k] + 1 < a.base) {
+        ++d[k];
+        a.reversed += p[k];
+        return;
+      }
+      a.reversed -= (a.base - 1) * p[k];
+      d[k] = 0;
+    }
+  }
+
+  static auto to_unit(axis const& a) noexcept -> double {
+    // The conversion rounds, which can reach 1 from just below it.
+    return std::min(static_cast<double>(a.reversed) * a.scale, 1.0 - 0x1p-53);
+  }
+
+  static constexpr auto next_prime(std::uint32_t n) noexcept -> std::uint32_t {
+    while (true) {
+      ++n;
+      auto prime = n >= 2;
+      for (std::uint32_t f = 2; f * f <= n && prime; ++f) { prime = n % f != 0; }
+      if (prime) { return n; }
+    }
+  }
+};
+
+}  // namespace mattsep::random::quasi
+
+#endif
@@ -0,0 +1,352 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_QUASI_SOBOL_HPP_INCLUDED
+#define MATTSEP_RANDOM_QUASI_SOBOL_HPP_INCLUDED
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <iterator>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "mattsep/random/concepts.hpp"
+#include "mattsep/random/internal.hpp"
+#include "mattsep/random/internal/sobol_table.hpp"
+
+namespace mattsep::random::quasi {
+
+/**
+ * @brief The primitive polynomial and initial direction numbers of one Sobol dimension, in the
+ * notation of Joe and Kuo.
+ *
+ * The polynomial x^s + a_1 x^(s-1) + ... + a_(s-1) x + 1 has degree `degree` and its inner
+ * coefficients a_1, ..., a_(s-1) are the bits of `coefficients`, a_1 the highest. `initial` holds
+ * m_1, ..., m_s, where each m_k is odd and less than 2^k.
+ */
+struct sobol_parameters {
+  std::uint32_t degree = 0;
+  std::uint32_t coefficients = 0;
+  std::vector<std::uint32_t> initial = {};
+
+  auto operator==(sobol_parameters const& rhs) const -> bool = default;
+};
+
+}  // namespace mattsep::random::quasi
+
+namespace mattsep::random::internal {
+
+inline auto valid_sobol_parameters(quasi::sobol_parameters const& p) noexcept -> bool {
+  if (p.degree == 0 || p.degree > 63 || p.initial.size() != p.degree) { return false; }
+  if (p.coefficients >> (p.degree - 1) != 0) { return false; }
+  for (std::size_t k = 0; k < p.initial.size(); ++k) {
+    const auto m = static_cast<std::uint64_t>(p.initial[k]);
+    if (m % 2 == 0 || m >> (k + 1) != 0) { return false; }
+  }
+  return true;
+}
+
+}  // namespace mattsep::random::internal
+
+namespace mattsep::random::quasi {
+
+/**
+ * @brief Reads direction numbers in the format of Joe and Kuo's files, such as new-joe-kuo-6.21201.
+ *
+ * Each line holds d, s, a and m_1, ..., m_s for dimension d, starting from dimension 2; a header
+ * line that does not start with a number is skipped. The result can be passed to `sobol` for more
+ * dimensions than its built-in table has.
+ */
+inline auto read_joe_kuo(std::istream& in) -> std::vector<sobol_parameters> {
+  auto out = std::vector<sobol_parameters>{};
+  auto line = std::string{};
+  auto number = std::size_t{0};
+  while (std::getline(in, line)) {
+    ++number;
+    const auto first = line.find_first_not_of(" \t\r");
+    if (first == std::string::npos) { continue; }
+    if (number == 1 && (line[first] < '0' || line[first] > '9')) { continue; }
+
+    const auto fail = [&] {
+      throw std::invalid_argument("read_joe_kuo: malformed line " + std::to_string(number));
+    };
+    auto fields = std::istringstream{line};
+    auto d = std::uint64_t{0};
+    auto p = sobol_parameters{};
+    if (!(fields >> d >> p.degree >> p.coefficients) || d != out.size() + 2 || p.degree > 63) {
+      fail();
+    }
+    p.initial.resize(p.degree);
+    for (auto& m : p.initial) {
+      if (!(fields >> m)) { fail(); }
+    }
+    if (!internal::valid_sobol_parameters(p) || !(fields >> std::ws).eof()) { fail(); }
+    out.push_back(std::move(p));
+  }
+  return out;
+}
+
+/**
+ * @brief A Sobol sequence, the low-discrepancy points of Sobol's construction with Joe and Kuo's
+ * direction numbers.
+ *
+ * Points are visited in Gray code order, so each one differs from the previous by a single XOR per
+ * dimension, and `seek` jumps to any index in O(64 d) operations. Threads can therefore take
+ * disjoint ranges of indices from copies of one sequence. The first 2^m points of every dimension
+ * fall one into each interval [i / 2^m, (i + 1) / 2^m).
+ *
+ * `scramble` applies a hashed Owen scrambling, seeded from an engine. It keeps this stratification
+ * while making the points random, so independent scramblings give unbiased estimates and an error
+ * bar, and the point at index 0 is no longer the origin.
+ *
+ * Points are computed with 64-bit direction numbers and returned as doubles with 53 bits.
+ */
+class sobol {
+public:
+  using value_type = double;
+
+  /// The number of dimensions covered by the built-in table.
+  static constexpr std::size_t max_dimensions = std::size(internal::sobol_polynomials) + 1;
+
+  /**
+   * @brief Creates the unscrambled sequence in @a dimensions dimensions, starting at index 0.
+   */
+  explicit sobol(std::size_t dimensions) : dimensions_{dimensions} {
+    if (dimensions == 0 || dimensions > max_dimensions) {
+      throw std::invalid_argument("sobol: the built-in table has 1 to " +
+                                  std::to_string(max_dimensions) + " dimensions");
+    }
+    directions_.resize(bits * dimensions);
+    first_dimension();
+
+    auto m = std::begin(internal::sobol_initial);
+    for (std::size_t j = 1; j < dimensions; ++j) {
+      const auto poly = static_cast<std::uint32_t>(internal::sobol_polynomials[j - 1]);
+      auto p = sobol_parameters{};
+      p.degree = static_cast<std::uint32_t>(std::bit_width(poly) - 1);
+      p.coefficients = (poly >> 1) & ((1u << (p.degree - 1)) - 1);
+      p.initial.assign(m, m + p.degree);
+      m += p.degree;
+      fill_dimension(j, p);
+    }
+    points_.resize(dimensions);
+  }
+
+  /**
+   * @brief Creates the unscrambled sequence in @a dimensions dimensions from @a parameters, which
+   * describe dimensions 2 and up, for example as read by `read_joe_kuo`.
+   */
+  sobol(std::size_t dimensions, std::span<sobol_parameters const> parameters)
+      : dimensions_{dimensions} {
+    if (dimensions == 0 || dimensions > parameters.size() + 1) {
+      throw std::invalid_argument("sobol: not enough parameters for the dimensions");
+    }
+    directions_.resize(bits * dimensions);
+    first_dimension();
+    for (std::size_t j = 1; j < dimensions; ++j) {
+      if (!internal::valid_sobol_parameters(parameters[j - 1])) {
+        throw std::invalid_argument("sobol: invalid parameters for dimension " +
+                                    std::to_string(j + 1));
+      }
+      fill_dimension(j, parameters[j - 1]);
+    }
+    points_.resize(dimensions);
+  }
+
+  /**
+   * @brief Scrambles every dimension with its own seed drawn from @a g.
+   *
+   * The scrambling is the hash-based Owen scrambling of Burley (2020), widened to 64 bits. It is
+   * applied to the points as they are output, so `seek` and `discard` are unaffected.
+   */
+  template <uniform_random_bit_generator G>
+  auto scramble(G& g) -> void {
+    seeds_.resize(dimensions_);
+    internal::generate_words(g, std::span<std::uint64_t>{seeds_});
+    reversed_.resize(directions_.size());
+    std::transform(directions_.begin(), directions_.end(), reversed_.begin(), reverse);
+  }
+
+  [[nodiscard]] auto scrambled() const noexcept -> bool {
+    return !seeds_.empty();
+  }
+
+  [[nodiscard]] auto dimensions() const noexcept -> std::size_t {
+    return dimensions_;
+  }
+
+  /**
+   * @brief Returns the index of the next point.
+   */
+  [[nodiscard]] auto index() const noexcept -> std::uint64_t {
+    return index_;
+  }
+
+  /**
+   * @brief Moves to the point at @a index, so that it is the next one output.
+   */
+  auto seek(std::uint64_t index) noexcept -> void {
+    std::fill(points_.begin(), points_.end(), std::uint64_t{0});
+    const auto gray = index ^ (index >> 1);
+    for (std::size_t k = 0; k < bits; ++k) {
+      if ((gray >> k & 1) == 0) { continue; }
+      const auto* v = directions_.data() + k * dimensions_;
+      for (std::size_t j = 0; j < dimensions_; ++j) { points_[j] ^= v[j]; }
+    }
+    index_ = index;
+  }
+
+  auto discard(std::uint64_t n) noexcept -> void {
+    seek(index_ + n);
+  }
+
+  /**
+   * @brief Writes the next point to @a point, which must have one element per dimension.
+   */
+  auto next(std::span<double> point) -> void {
+    if (point.size() != dimensions_) {
+      throw std::invalid_argument("sobol: the point must have one element per dimension");
+    }
+    for (std::size_t j = 0; j < dimensions_; ++j) { point[j] = to_unit(output(j, points_[j])); }
+
+    const auto* v = directions_.data() + step(index_) * dimensions_;
+    for (std::size_t j = 0; j < dimensions_; ++j) { points_[j] ^= v[j]; }
+    ++index_;
+  }
+
+  /**
+   * @brief Fills @a out with the next `n = out.size() / dimensions()` points, one dimension after
+   * another: coordinate j of the i-th point is `out[j * n + i]`.
+   *
+   * The size of @a out must be a multiple of the number of dimensions.
+   */
+  auto generate(std::span<double> out) -> void {
+    if (out.size() % dimensions_ != 0) {
+      throw std::invalid_argument("sobol: the output must hold a whole number of points");
+    }
+    const auto n = out.size() / dimensions_;
+    for (std::size_t j = 0; j < dimensions_; ++j) { generate_column(j, out.subspan(j * n, n)); }
+    index_ += n;
+  }
+
+private:
+  static constexpr std::size_t bits = 64;
+
+  std::size_t dimensions_;
+  // Direction number k of dimension j is at k * dimensions_ + j.
+  std::vector<std::uint64_t> directions_;
+  std::vector<std::uint64_t> points_;
+  std::vector<std::uint64_t> seeds_;
+  std::vector<std::uint64_t> reversed_;
+  std::uint64_t index_ = 0;
+
+  auto first_dimension() noexcept -> void {
+    for (std::size_t k = 0; k < bits; ++k) { directions_[k * dimensions_] = 1ull << (63 - k); }
+  }
+
+  // The recurrence of Bratley and Fox, on direction numbers v_k = m_k 2^(64 - k).
+  auto fill_dimension(std::size_t j, sobol_parameters const& p) noexcept -> void {
+    const auto s = std::size_t{p.degree};
+    const auto v = [&](std::size_t k) -> std::uint64_t& {
+      return directions_[k * dimensions_ + j];
+    };
+    for (std::size_t k = 0; k < s; ++k) {
+      v(k) = static_cast<std::uint64_t>(p.initial[k]) << (63 - k);
+    }
+    for (std::size_t k = s; k < bits; ++k) {
+      auto x = v(k - s) ^ (v(k - s) >> s);
+      for (std::size_t i = 1; i < s; ++i) {
+        if ((p.coefficients >> (s - 1 - i) & 1) != 0) { x ^= v(k - i); }
+      }
+      v(k) = x;
+    }
+  }
+
+  // The direction number that takes the point at index n to the one at n + 1. After the last index
+  // the sequence wraps around to the origin.
+  static constexpr auto step(std::uint64_t n) noexcept -> std::size_t {
+    return static_cast<std::size_t>(std::countr_zero((n + 1) | (1ull << 63)));
+  }
+
+  // Scrambled columns are stepped through with bit-reversed direction numbers, which are XORed
+  // just the same and save reversing every point before it is hashed.
+  auto generate_column(std::size_t j, std::span<double> out) noexcept -> void {
+    auto n = index_;
+    if (scrambled()) {
+      const auto seed = seeds_[j];
+      auto x = reverse(points_[j]);
+      for (auto& u : out) {
+        u = to_unit(reverse(owen_hash(x, seed)));
+        x ^= reversed_[step(n++) * dimensions_ + j];
+      }
+      points_[j] = reverse(x);
+    } else {
+      auto x = points_[j];
+      for (auto& u : out) {
+        u = to_unit(x);
+        x ^= directions_[step(n++) * dimensions_ + j];
+      }
+      points_[j] = x;
+    }
+  }
+
+  auto output(std::size_t j, std::uint64_t x) const noexcept -> std::uint64_t {
+    return scrambled() ? reverse(owen_hash(reverse(x), seeds_[j])) : x;
+  }
+
+  static constexpr auto to_unit(std::uint64_t x) noexcept -> double {
+    return static_cast<double>(x >> 11) * 0x1p-53;
+  }
+
+  static constexpr auto reverse(std::uint64_t x) noexcept -> std::uint64_t {
+    x = ((x >> 1) & 0x5555555555555555) | ((x & 0x5555555555555555) << 1);
+    x = ((x >> 2) & 0x3333333333333333) | ((x & 0x3333333333333333) << 2);
+    x = ((x >> 4) & 0x0F0F0F0F0F0F0F0F) | ((x & 0x0F0F0F0F0F0F0F0F) << 4);
+    x = ((x >> 8) & 0x00FF00FF00FF00FF) | ((x & 0x00FF00FF00FF00FF) << 8);
+    x = ((x >> 16) & 0x0000FFFF0000FFFF) | ((x & 0x0000FFFF0000FFFF) << 16);
+    return (x >> 32) | (x << 32);
+  }
+
+  // Hashes the bit-reversed point @a x. Every step changes each bit by a function of the bits below
+  // it only, so on the point itself each bit is flipped by a function of the bits above it: a
+  // nested scrambling, which is a bijection on every dyadic interval.
+  static constexpr auto owen_hash(std::uint64_t x, std::uint64_t seed) noexcept -> std::uint64_t {
+    x ^= x * 0xBF58476D1CE4E5BA;
+    x += seed;
+    x *= (seed >> 32) | 1;
+    x ^= x * 0x94D049BB133111EA;
+    x ^= x * 0xD1B54A32D192ED02;
+    return x;
+  }
+};
+
+}  // namespace mattsep::random::quasi
+
+#endif
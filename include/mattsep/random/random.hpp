@@ -25,9 +25,15 @@
 #ifndef MATTSEP_RANDOM_RANDOM_HPP_INCLUDED
 #define MATTSEP_RANDOM_RANDOM_HPP_INCLUDED
 
+#include "mattsep/random/algorithms.hpp"
+#include "mattsep/random/any_engine.hpp"
 #include "mattsep/random/concepts.hpp"
 #include "mattsep/random/distributions.hpp"
 #include "mattsep/random/engines.hpp"
+#include "mattsep/random/parallel.hpp"
 #include "mattsep/random/rng.hpp"
+#include "mattsep/random/seeding.hpp"
+#include "mattsep/random/serialization.hpp"
+#include "mattsep/random/views.hpp"
 
 #endif  // MATTSEP_RANDOM_RANDOM_HPP_INCLUDED
\ No newline at end of file
@@ -27,12 +27,17 @@
 
 #include <bit>
 #include <concepts>
+#include <cstddef>
 #include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
 
 #include "mattsep/random/concepts.hpp"
 #include "mattsep/random/distributions.hpp"
 #include "mattsep/random/engines.hpp"
 #include "mattsep/random/internal.hpp"
+#include "mattsep/random/views.hpp"
 
 namespace mattsep::random {
 
@@ -41,10 +46,11 @@ class rng {
 public:
   using engine_type = Engine;
 
-  rng() = default;
+  constexpr rng() = default;
+  constexpr explicit rng(engine_type engine) : engine_{std::move(engine)} {}
 
   template <class ResultOrDistribution = double, class... Args>
-  auto random(Args&&... args) {
+  constexpr auto random(Args&&... args) {
     if constexpr (random_number_distribution<ResultOrDistribution>) {
       return ResultOrDistribution{std::forward<Args>(args)...}(engine_);
     } else {
@@ -52,6 +58,52 @@ public:
     }
   }
 
+  /**
+   * @brief Returns an endless view of values, drawn as `random` would draw them, in blocks.
+   *
+   * The view uses this generator's engine, so the generator must outlive it.
+   */
+  template <class ResultOrDistribution = double, class... Args>
+  constexpr auto view(Args&&... args) {
+    if constexpr (random_number_distribution<ResultOrDistribution>) {
+      return random::view(engine_, ResultOrDistribution{std::forward<Args>(args)...});
+    } else {
+      using distribution = distributions::uniform<ResultOrDistribution>;
+      return random::view(engine_, distribution{std::forward<Args>(args)...});
+    }
+  }
+
+  template <class T, class... Args>
+  constexpr auto fill(std::span<T> out, Args&&... args) -> void {
+    distributions::uniform<T>{std::forward<Args>(args)...}.generate(engine_, out);
+  }
+
+  template <class T, class Distribution>
+  requires random_number_distribution<std::remove_cvref_t<Distribution>>
+  constexpr auto fill(std::span<T> out, Distribution&& dist) -> void {
+    internal::generate(dist, engine_, out);
+  }
+
+  constexpr auto fill_bytes(std::span<std::byte> out) -> void {
+    internal::fill_bytes(engine_, out);
+  }
+
+  /**
+   * @brief Returns the state of the engine; see `serialization.hpp` for a portable encoding.
+   */
+  constexpr auto state() const noexcept
+  requires restorable_random_bit_generator<engine_type>
+  {
+    return engine_.state();
+  }
+
+  template <class State>
+  requires restorable_random_bit_generator<engine_type> &&
+           std::same_as<State, typename engine_type::state_type>
+  static constexpr auto from_state(State const& s) noexcept -> rng {
+    return rng{engine_type::from_state(s)};
+  }
+
 private:
   engine_type engine_ = {};
 };
@@ -0,0 +1,161 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_SEEDING_HPP_INCLUDED
+#define MATTSEP_RANDOM_SEEDING_HPP_INCLUDED
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <system_error>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/random.h>
+#else
+#include <random>
+#endif
+
+#include "mattsep/random/concepts.hpp"
+#include "mattsep/random/internal.hpp"
+
+namespace mattsep::random {
+
+/**
+ * @brief An engine that can be seeded from a span of seed material of any length.
+ */
+template <class G>
+concept material_seedable = uniform_random_bit_generator<G> &&
+    requires(G& g, std::span<typename G::result_type const> material) { g.seed(material); };
+
+/**
+ * @brief Fills @a out with entropy from the operating system.
+ *
+ * Uses `getrandom` on Linux, retrying after interruptions and short reads, and
+ * `std::random_device` elsewhere.
+ *
+ * @throws std::system_error if the operating system reports an error
+ */
+inline auto os_entropy(std::span<std::byte> out) -> void {
+#if defined(__linux__)
+  while (!out.empty()) {
+    const auto n = ::getrandom(out.data(), out.size(), 0);
+    if (n < 0) {
+      if (errno == EINTR) { continue; }
+      throw std::system_error(errno, std::generic_category(), "os_entropy: getrandom failed");
+    }
+    out = out.subspan(static_cast<std::size_t>(n));
+  }
+#else
+  auto device = std::random_device{};
+  while (!out.empty()) {
+    const auto word = device();
+    const auto n = std::min(out.size(), sizeof(word));
+    std::memcpy(out.data(), &word, n);
+    out = out.subspan(n);
+  }
+#endif
+}
+
+/**
+ * @brief Seeds every engine of @a engines from @a material, followed by the engine's index.
+ *
+ * `engines[i]` ends up seeded with the words of @a material and then `i`, each 64-bit word split
+ * into two for engines with 32-bit words. Engines that can be seeded from an `internal::seed_hash`
+ * share one hash of @a material and each finish it with their index, so the cost per engine does
+ * not depend on the length of the material. Other engines hash all of it, one engine at a time.
+ */
+template <material_seedable Engine>
+auto seed_many(std::span<Engine> engines, std::span<std::uint64_t const> material) -> void {
+  using result_type = typename Engine::result_type;
+  constexpr auto split = std::numeric_limits<result_type>::digits < 64;
+  constexpr auto per_word = split ? std::size_t{2} : std::size_t{1};
+
+  if constexpr (requires(Engine& e, internal::seed_hash const& h) { e.seed(h); }) {
+    auto absorb = [](internal::seed_hash& hash, std::uint64_t x) {
+      if constexpr (split) {
+        hash.absorb(static_cast<result_type>(x));
+        hash.absorb(static_cast<result_type>(x >> 32));
+      } else {
+        hash.absorb(x);
+      }
+    };
+    auto prefix = internal::seed_hash{(material.size() + 1) * per_word};
+    for (auto w : material) { absorb(prefix, w); }
+
+    for (std::size_t i = 0; i < engines.size(); ++i) {
+      auto hash = prefix;
+      absorb(hash, static_cast<std::uint64_t>(i));
+      engines[i].seed(hash);
+    }
+  } else {
+    auto words = std::vector<result_type>((material.size() + 1) * per_word);
+    auto store = [&](std::size_t i, std::uint64_t x) {
+      if constexpr (split) {
+        words[2 * i] = static_cast<result_type>(x);
+        words[2 * i + 1] = static_cast<result_type>(x >> 32);
+      } else {
+        words[i] = static_cast<result_type>(x);
+      }
+    };
+    for (std::size_t j = 0; j < material.size(); ++j) { store(j, material[j]); }
+
+    const auto seed = std::span<result_type const>{words};
+    for (std::size_t i = 0; i < engines.size(); ++i) {
+      store(material.size(), static_cast<std::uint64_t>(i));
+      engines[i].seed(seed);
+    }
+  }
+}
+
+/**
+ * @brief Seeds `engines[i]` from the material `{seed, i}`; see the overload taking a span.
+ */
+template <material_seedable Engine>
+auto seed_many(std::span<Engine> engines, std::uint64_t seed) -> void {
+  const auto material = std::array{seed};
+  seed_many(engines, std::span<std::uint64_t const>{material});
+}
+
+/**
+ * @brief Seeds every engine of @a engines from 256 bits of operating system entropy.
+ *
+ * The entropy is read once and shared, with each engine's index appended, so a single system call
+ * covers any number of engines.
+ */
+template <material_seedable Engine>
+auto seed_many(std::span<Engine> engines) -> void {
+  auto material = std::array<std::uint64_t, 4>{};
+  os_entropy(std::as_writable_bytes(std::span{material}));
+  seed_many(engines, std::span<std::uint64_t const>{material});
+}
+
+}  // namespace mattsep::random
+
+#endif
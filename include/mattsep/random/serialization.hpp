@@ -0,0 +1,187 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_SERIALIZATION_HPP_INCLUDED
+#define MATTSEP_RANDOM_SERIALIZATION_HPP_INCLUDED
+
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include "mattsep/random/concepts.hpp"
+
+/*
+ * Checkpointing of engine state without iostreams.
+ *
+ * An engine is encoded as the words of its `state()`, in order, each word little-endian. There is
+ * no header or padding, so an array of engines encodes to `size * state_bytes<Engine>` bytes and
+ * record `i` starts at byte `i * state_bytes<Engine>`. On little-endian machines encoding and
+ * decoding a state are plain copies; the buffer may be any memory, including a mapped file.
+ */
+
+namespace mattsep::random {
+
+/**
+ * @brief The number of bytes an engine of type @a Engine encodes to.
+ */
+template <restorable_random_bit_generator Engine>
+inline constexpr std::size_t state_bytes = std::tuple_size_v<typename Engine::state_type> *
+                                           sizeof(typename Engine::state_type::value_type);
+
+namespace internal {
+
+  template <class State>
+  auto encode_state(State const& s, std::byte* out) noexcept -> void {
+    using word_type = typename State::value_type;
+    if constexpr (std::endian::native == std::endian::little) {
+      std::memcpy(out, s.data(), s.size() * sizeof(word_type));
+    } else {
+      for (auto word : s) {
+        for (std::size_t i = 0; i < sizeof(word_type); ++i) {
+          *out++ = static_cast<std::byte>(word >> (8 * i));
+        }
+      }
+    }
+  }
+
+  template <class State>
+  auto decode_state(std::byte const* in) noexcept -> State {
+    using word_type = typename State::value_type;
+    auto s = State{};
+    if constexpr (std::endian::native == std::endian::little) {
+      std::memcpy(s.data(), in, s.size() * sizeof(word_type));
+    } else {
+      for (auto& word : s) {
+        word = 0;
+        for (std::size_t i = 0; i < sizeof(word_type); ++i) {
+          word |= static_cast<word_type>(static_cast<word_type>(*in++) << (8 * i));
+        }
+      }
+    }
+    return s;
+  }
+
+}  // namespace internal
+
+/**
+ * @brief Encodes every engine of @a engines into the front of @a out.
+ *
+ * @return The part of @a out after the encoded engines
+ * @throws std::length_error if @a out is too small, in which case nothing is written
+ */
+template <std::ranges::sized_range R>
+requires restorable_random_bit_generator<std::ranges::range_value_t<R>>
+auto save_states(R const& engines, std::span<std::byte> out) -> std::span<std::byte> {
+  using engine_type = std::ranges::range_value_t<R>;
+  constexpr auto bytes = state_bytes<engine_type>;
+
+  const auto count = static_cast<std::size_t>(std::ranges::size(engines));
+  if (out.size() / bytes < count) {
+    throw std::length_error("save_states: the buffer is too small");
+  }
+
+  auto* p = out.data();
+  for (auto const& engine : engines) {
+    internal::encode_state(engine.state(), p);
+    p += bytes;
+  }
+  return out.subspan(count * bytes);
+}
+
+/**
+ * @brief Restores every engine of @a engines from the front of @a in.
+ *
+ * @return The part of @a in after the decoded engines
+ * @throws std::length_error if @a in is too short, in which case no engine is changed
+ */
+template <std::ranges::sized_range R>
+requires std::ranges::output_range<R, std::ranges::range_value_t<R>> &&
+         restorable_random_bit_generator<std::ranges::range_value_t<R>>
+auto load_states(std::span<std::byte const> in, R&& engines) -> std::span<std::byte const> {
+  using engine_type = std::ranges::range_value_t<R>;
+  using state_type = typename engine_type::state_type;
+  constexpr auto bytes = state_bytes<engine_type>;
+
+  const auto count = static_cast<std::size_t>(std::ranges::size(engines));
+  if (in.size() / bytes < count) { throw std::length_error("load_states: the input is too short"); }
+
+  auto const* p = in.data();
+  for (auto& engine : engines) {
+    engine = engine_type::from_state(internal::decode_state<state_type>(p));
+    p += bytes;
+  }
+  return in.subspan(count * bytes);
+}
+
+/**
+ * @brief Decodes all of @a in, which must hold a whole number of encoded engines.
+ *
+ * The engines are built straight from their states, without being seeded first.
+ *
+ * @throws std::length_error if the size of @a in is not a multiple of `state_bytes<Engine>`
+ */
+template <restorable_random_bit_generator Engine>
+auto load_states(std::span<std::byte const> in) -> std::vector<Engine> {
+  using state_type = typename Engine::state_type;
+  constexpr auto bytes = state_bytes<Engine>;
+
+  if (in.size() % bytes != 0) {
+    throw std::length_error("load_states: the input is not a whole number of states");
+  }
+
+  auto engines = std::vector<Engine>{};
+  engines.reserve(in.size() / bytes);
+  for (auto const* p = in.data(); p != in.data() + in.size(); p += bytes) {
+    engines.push_back(Engine::from_state(internal::decode_state<state_type>(p)));
+  }
+  return engines;
+}
+
+/**
+ * @brief Encodes @a engine into the front of @a out; see `save_states`.
+ */
+template <restorable_random_bit_generator Engine>
+auto save_state(Engine const& engine, std::span<std::byte> out) -> std::span<std::byte> {
+  return save_states(std::span{&engine, 1}, out);
+}
+
+/**
+ * @brief Decodes an engine from the front of @a in; see `load_states`.
+ */
+template <restorable_random_bit_generator Engine>
+auto load_state(std::span<std::byte const> in) -> Engine {
+  if (in.size() < state_bytes<Engine>) {
+    throw std::length_error("load_state: the input is too short");
+  }
+  return Engine::from_state(internal::decode_state<typename Engine::state_type>(in.data()));
+}
+
+}  // namespace mattsep::random
+
+#endif
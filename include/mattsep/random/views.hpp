@@ -0,0 +1,138 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2021 Matthew S. E. Peterson
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MATTSEP_RANDOM_VIEWS_HPP_INCLUDED
+#define MATTSEP_RANDOM_VIEWS_HPP_INCLUDED
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <utility>
+
+#include "mattsep/random/concepts.hpp"
+#include "mattsep/random/internal.hpp"
+
+namespace mattsep::random {
+
+/**
+ * @brief An endless input range of values drawn from a distribution.
+ *
+ * Values are generated a block at a time through the distribution's bulk path, into a buffer held
+ * by the view, and iteration only reads from that buffer. A block is generated the first time one
+ * of its values is read, so the engine is advanced `block_size` values at a time. The view refers
+ * to the engine, which must outlive it; like other input views, it may not be moved while it is
+ * being iterated.
+ *
+ * @tparam G The engine type
+ * @tparam Distribution The distribution type
+ */
+template <uniform_random_bit_generator G, random_number_distribution Distribution>
+class random_view : public std::ranges::view_interface<random_view<G, Distribution>> {
+public:
+  using value_type = typename Distribution::result_type;
+
+  static constexpr std::size_t block_size = 256;
+
+  constexpr random_view() = default;
+  constexpr random_view(G& g, Distribution dist) : g_{std::addressof(g)}, dist_{std::move(dist)} {}
+
+  class iterator {
+  public:
+    using value_type = typename Distribution::result_type;
+    using difference_type = std::ptrdiff_t;
+    using iterator_concept = std::input_iterator_tag;
+
+    constexpr iterator() = default;
+    constexpr explicit iterator(random_view& parent) : parent_{std::addressof(parent)} {}
+
+    constexpr iterator(iterator&&) = default;
+    constexpr auto operator=(iterator&&) -> iterator& = default;
+
+    constexpr auto operator*() const -> value_type const& {
+      if (next_ == last_) { refill(); }
+      return *next_;
+    }
+
+    constexpr auto operator++() -> iterator& {
+      if (next_ == last_) { refill(); }
+      ++next_;
+      return *this;
+    }
+
+    constexpr auto operator++(int) -> void {
+      ++*this;
+    }
+
+    friend constexpr auto operator==(iterator const&, std::unreachable_sentinel_t) -> bool {
+      return false;
+    }
+
+  private:
+    random_view* parent_ = nullptr;
+    // The position is kept here rather than in the view so that it can live in a register.
+    mutable value_type const* next_ = nullptr;
+    mutable value_type const* last_ = nullptr;
+
+    constexpr auto refill() const -> void {
+      parent_->refill();
+      next_ = parent_->block_.data();
+      last_ = next_ + block_size;
+    }
+  };
+
+  /**
+   * @brief Returns an iterator to the next value; as with any input view, call this only once.
+   */
+  constexpr auto begin() -> iterator {
+    return iterator{*this};
+  }
+
+  constexpr auto end() const noexcept -> std::unreachable_sentinel_t {
+    return std::unreachable_sentinel;
+  }
+
+private:
+  G* g_ = nullptr;
+  Distribution dist_ = {};
+  std::array<value_type, block_size> block_ = {};
+
+  constexpr auto refill() -> void {
+    internal::generate(dist_, *g_, std::span<value_type>{block_});
+  }
+};
+
+/**
+ * @brief Returns an endless view of values drawn from @a dist with @a g; see `random_view`.
+ */
+template <uniform_random_bit_generator G, random_number_distribution Distribution>
+constexpr auto view(G& g, Distribution dist) -> random_view<G, Distribution> {
+  return random_view<G, Distribution>{g, std::move(dist)};
+}
+
+}  // namespace mattsep::random
+
+#endif
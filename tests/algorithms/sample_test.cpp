@@ -0,0 +1,119 @@
+#include "mattsep/random/algorithms/sample.hpp"
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <ranges>
+#include <sstream>
+#include <vector>
+
+#include "mattsep/random/engines.hpp"
+
+namespace {
+  // Counts how often each of the first n integers is chosen over many samples of size k.
+  template <class Sampler>
+  auto inclusion_counts(int n, std::size_t k, int trials, Sampler sampler) -> std::vector<int> {
+    auto counts = std::vector<int>(static_cast<std::size_t>(n));
+    auto out = std::vector<int>(k);
+    for (int i = 0; i < trials; ++i) {
+      const auto end = sampler(out.begin());
+      REQUIRE(end == out.end());
+      for (auto x : out) { ++counts[static_cast<std::size_t>(x)]; }
+    }
+    return counts;
+  }
+}  // namespace
+
+// NOLINTNEXTLINE
+TEST_CASE("mattsep::random::sample") {
+  auto engine = mattsep::random::default_random_engine{};
+
+  SUBCASE("small ranges are copied whole") {
+    const auto values = std::vector{1, 2, 3};
+    auto out = std::vector<int>(5);
+    const auto end = mattsep::random::sample(values, 5, out.begin(), engine);
+    CHECK(end == out.begin() + 3);
+    CHECK(std::equal(values.begin(), values.end(), out.begin()));
+
+    auto empty = std::vector<int>{};
+    mattsep::random::sample(values, 0, std::back_inserter(empty), engine);
+    CHECK(empty.empty());
+  }
+
+  SUBCASE("selection sampling") {
+    auto values = std::list<int>(20);
+    std::iota(values.begin(), values.end(), 0);
+
+    auto counts = inclusion_counts(20, 5, 20000, [&](auto out) {
+      const auto end = mattsep::random::sample(values, 5, out, engine);
+      CHECK(std::is_sorted(out, end));
+      CHECK(std::adjacent_find(out, end) == end);
+      return end;
+    });
+    for (auto c : counts) {
+      CHECK(c > 4700);
+      CHECK(c < 5300);
+    }
+  }
+
+  SUBCASE("floyd sampling") {
+    auto values = std::vector<int>(1000);
+    std::iota(values.begin(), values.end(), 0);
+
+    auto counts = inclusion_counts(1000, 10, 50000, [&](auto out) {
+      const auto end = mattsep::random::sample(values, 10, out, engine);
+      CHECK(std::is_sorted(out, end));
+      CHECK(std::adjacent_find(out, end) == end);
+      return end;
+    });
+    for (auto c : counts) {
+      CHECK(c > 380);
+      CHECK(c < 630);
+    }
+  }
+
+  SUBCASE("reservoir sampling") {
+    auto counts = inclusion_counts(200, 10, 20000, [&](auto out) {
+      // an input range of unknown size
+      auto stream = std::istringstream{};
+      auto text = std::string{};
+      for (int i = 0; i < 200; ++i) { text += std::to_string(i) + ' '; }
+      stream.str(text);
+
+      const auto end = mattsep::random::sample(std::views::istream<int>(stream), 10, out, engine);
+      std::sort(out, end);
+      CHECK(std::adjacent_find(out, end) == end);
+      return end;
+    });
+    for (auto c : counts) {
+      CHECK(c > 850);
+      CHECK(c < 1150);
+    }
+
+    auto stream = std::istringstream{"1 2 3"};
+    auto out = std::array<int, 8>{};
+    const auto end = mattsep::random::sample(std::views::istream<int>(stream), 8, out.begin(),
+                                             engine);
+    CHECK(end == out.begin() + 3);
+  }
+
+  SUBCASE("reproducible") {
+    auto values = std::vector<int>(10000);
+    std::iota(values.begin(), values.end(), 0);
+
+    auto first = engine;
+    auto second = engine;
+    auto a = std::vector<int>{};
+    auto b = std::vector<int>{};
+    mattsep::random::sample(values, 100, std::back_inserter(a), first);
+    mattsep::random::sample(values, 100, std::back_inserter(b), second);
+    CHECK(a == b);
+    CHECK(a.size() == 100);
+  }
+}
@@ -0,0 +1,87 @@
+#include "mattsep/random/algorithms/shuffle.hpp"
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <numeric>
+#include <vector>
+
+#include "mattsep/random/engines.hpp"
+
+// NOLINTNEXTLINE
+TEST_CASE("mattsep::random::shuffle") {
+  auto engine = mattsep::random::default_random_engine{};
+
+  SUBCASE("permutations") {
+    for (std::size_t n : {0u, 1u, 2u, 63u, 64u, 65u, 1000u}) {
+      auto values = std::vector<int>(n);
+      std::iota(values.begin(), values.end(), 0);
+      auto shuffled = values;
+
+      CHECK(mattsep::random::shuffle(shuffled, engine) == shuffled.end());
+      CHECK(std::is_permutation(values.begin(), values.end(), shuffled.begin()));
+    }
+  }
+
+  SUBCASE("uniformity") {
+    constexpr int trials = 60000;
+    auto counts = std::map<std::array<int, 3>, int>{};
+    for (int i = 0; i < trials; ++i) {
+      auto values = std::array{0, 1, 2};
+      mattsep::random::shuffle(values.begin(), values.end(), engine);
+      ++counts[values];
+    }
+
+    CHECK(counts.size() == 6);
+    for (auto [permutation, count] : counts) {
+      CHECK(count > 9500);
+      CHECK(count < 10500);
+    }
+  }
+
+  SUBCASE("every position is reachable") {
+    auto last = std::array<int, 100>{};
+    for (int i = 0; i < 20000; ++i) {
+      auto values = std::vector<int>(100);
+      std::iota(values.begin(), values.end(), 0);
+      mattsep::random::shuffle(values, engine);
+      ++last[static_cast<std::size_t>(values.back())];
+    }
+    CHECK(*std::min_element(last.begin(), last.end()) > 120);
+    CHECK(*std::max_element(last.begin(), last.end()) < 290);
+  }
+
+  SUBCASE("reproducible") {
+    auto a = std::vector<int>(500);
+    std::iota(a.begin(), a.end(), 0);
+    auto b = a;
+
+    auto first = engine;
+    auto second = engine;
+    mattsep::random::shuffle(a, first);
+    mattsep::random::shuffle(b, second);
+    CHECK(a == b);
+    CHECK(first == second);
+  }
+
+  SUBCASE("prefetching does not change the permutation") {
+    // large enough to cross shuffle_prefetch_bytes; a deque is never prefetched
+    constexpr std::size_t n = std::size_t{1} << 23;
+    static_assert(n * sizeof(std::uint64_t) > mattsep::random::shuffle_prefetch_bytes);
+
+    auto contiguous = std::vector<std::uint64_t>(n);
+    std::iota(contiguous.begin(), contiguous.end(), std::uint64_t{0});
+    auto segmented = std::deque<std::uint64_t>(contiguous.begin(), contiguous.end());
+
+    auto first = engine;
+    auto second = engine;
+    mattsep::random::shuffle(contiguous, first);
+    mattsep::random::shuffle(segmented, second);
+    CHECK(std::equal(contiguous.begin(), contiguous.end(), segmented.begin()));
+  }
+}
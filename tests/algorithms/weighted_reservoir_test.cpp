@@ -0,0 +1,125 @@
+#include "mattsep/random/algorithms/weighted_reservoir.hpp"
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "mattsep/random/engines.hpp"
+
+namespace {
+  struct counting_engine {
+    using result_type = std::uint64_t;
+
+    mattsep::random::default_random_engine engine = {};
+    std::uint64_t calls = 0;
+
+    auto operator()() -> result_type {
+      ++calls;
+      return engine();
+    }
+
+    static constexpr auto min() -> result_type {
+      return 0;
+    }
+
+    static constexpr auto max() -> result_type {
+      return ~result_type{0};
+    }
+  };
+}  // namespace
+
+// NOLINTNEXTLINE
+TEST_CASE("mattsep::random::weighted_reservoir") {
+  auto engine = mattsep::random::default_random_engine{};
+
+  SUBCASE("filling") {
+    auto reservoir = mattsep::random::weighted_reservoir<int>{3};
+    reservoir.push(1, 1.0, engine);
+    reservoir.push(2, 0.0, engine);
+    reservoir.push(3, 2.0, engine);
+    CHECK(reservoir.size() == 2);
+    CHECK(reservoir.seen() == 3);
+
+    auto sample = reservoir.sample();
+    std::sort(sample.begin(), sample.end());
+    CHECK((sample == std::vector{1, 3}));
+
+    CHECK_THROWS_AS(reservoir.push(4, -1.0, engine), std::invalid_argument);
+    reservoir.clear();
+    CHECK(reservoir.size() == 0);
+  }
+
+  SUBCASE("selection probabilities") {
+    const auto weights = std::array{1.0, 2.0, 3.0, 4.0, 5.0, 0.0};
+    const auto values = std::array{0, 1, 2, 3, 4, 5};
+
+    auto counts = std::array<int, 6>{};
+    for (int i = 0; i < 30000; ++i) {
+      auto reservoir = mattsep::random::weighted_reservoir<int>{1};
+      reservoir.push(values, weights, engine);
+      ++counts[static_cast<std::size_t>(reservoir.sample().front())];
+    }
+    for (std::size_t j = 0; j < 5; ++j) {
+      CHECK(counts[j] > 2000 * static_cast<int>(j + 1) - 300);
+      CHECK(counts[j] < 2000 * static_cast<int>(j + 1) + 300);
+    }
+    CHECK(counts[5] == 0);
+  }
+
+  SUBCASE("heavy items are kept") {
+    auto weights = std::vector<double>(1000, 1.0);
+    weights[500] = 1e6;
+    auto values = std::vector<int>(1000);
+    std::iota(values.begin(), values.end(), 0);
+
+    auto hits = 0;
+    for (int i = 0; i < 100; ++i) {
+      auto reservoir = mattsep::random::weighted_reservoir<int>{2};
+      reservoir.push(values, weights, engine);
+      const auto sample = reservoir.sample();
+      hits += std::count(sample.begin(), sample.end(), 500) > 0 ? 1 : 0;
+    }
+    CHECK(hits == 100);
+  }
+
+  SUBCASE("draws grow logarithmically") {
+    auto counting = counting_engine{};
+    auto reservoir = mattsep::random::weighted_reservoir<int>{10};
+    for (int i = 0; i < 1'000'000; ++i) { reservoir.push(i, 1.0 + (i % 3), counting); }
+    // about 10 + 2 * 10 * ln(10^5) draws in expectation
+    CHECK(counting.calls < 1000);
+    CHECK(reservoir.size() == 10);
+  }
+
+  SUBCASE("merging") {
+    auto left = std::array{0, 1, 2};
+    auto right = std::array{3, 4};
+    auto left_weights = std::array{1.0, 1.0, 2.0};
+    auto right_weights = std::array{3.0, 3.0};
+    auto other = mattsep::random::default_random_engine{12345};
+
+    auto counts = std::array<int, 5>{};
+    for (int i = 0; i < 20000; ++i) {
+      auto a = mattsep::random::weighted_reservoir<int>{1};
+      auto b = mattsep::random::weighted_reservoir<int>{1};
+      a.push(left, left_weights, engine);
+      b.push(right, right_weights, other);
+      a.merge(b, engine);
+      CHECK(a.seen() == 5);
+      ++counts[static_cast<std::size_t>(a.sample().front())];
+    }
+
+    // weights 1, 1, 2, 3, 3 out of 10
+    const auto expected = std::array{2000, 2000, 4000, 6000, 6000};
+    for (std::size_t j = 0; j < 5; ++j) {
+      CHECK(counts[j] > expected[j] - 300);
+      CHECK(counts[j] < expected[j] + 300);
+    }
+  }
+}
@@ -0,0 +1,111 @@
+#include "mattsep/random/any_engine.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "mattsep/random/concepts.hpp"
+#include "mattsep/random/distributions.hpp"
+#include "mattsep/random/engines.hpp"
+#include "mattsep/random/rng.hpp"
+
+namespace {
+  // A user engine with 16-bit output.
+  struct narrow_engine {
+    using result_type = std::uint16_t;
+
+    mattsep::random::engines::jsf32 engine = {};
+
+    auto operator()() -> result_type {
+      return static_cast<result_type>(engine() >> 16);
+    }
+
+    static constexpr auto min() -> result_type {
+      return 0;
+    }
+
+    static constexpr auto max() -> result_type {
+      return 0xFFFF;
+    }
+  };
+}  // namespace
+
+// NOLINTNEXTLINE
+TEST_CASE("mattsep::random::any_engine") {
+  namespace random = mattsep::random;
+
+  static_assert(random::uniform_random_bit_generator<random::any_engine>);
+  static_assert(random::bulk_random_bit_generator<random::any_engine>);
+
+  SUBCASE("matches the held engine") {
+    auto engine = random::engines::sfc64{99};
+    auto any = random::any_engine{engine};
+    for (int i = 0; i < 100; ++i) { CHECK(any() == engine()); }
+
+    // 32-bit engines are combined two outputs to a word, high half first
+    auto narrow = random::engines::jsf32{7};
+    auto any_narrow = random::any_engine{narrow};
+    for (int i = 0; i < 100; ++i) {
+      const auto hi = std::uint64_t{narrow()};
+      const auto lo = std::uint64_t{narrow()};
+      CHECK(any_narrow() == ((hi << 32) | lo));
+    }
+  }
+
+  SUBCASE("bulk and scalar output agree") {
+    auto a = random::any_engine::from_name("philox4x64", 3);
+    auto b = a;
+    CHECK(a.target<random::engines::philox4x64>() != nullptr);
+    CHECK(a.target<random::engines::jsf64>() == nullptr);
+
+    a();
+    b();
+    for (std::size_t n : {0u, 3u, 8u, 13u, 64u, 101u}) {
+      auto values = std::vector<std::uint64_t>(n);
+      a.generate(values);
+      for (auto x : values) { CHECK(x == b()); }
+    }
+  }
+
+  SUBCASE("engines by name") {
+    for (auto name : {"jsf32", "jsf64", "sfc32", "sfc64", "philox4x32", "philox4x64",
+                      "xoshiro256pp", "pcg64_dxsm", "wyrand", "romu_trio", "chacha20"}) {
+      auto first = random::any_engine::from_name(name, 1);
+      auto second = random::any_engine::from_name(name, 2);
+      CHECK(first() != second());
+    }
+    CHECK(random::any_engine::from_name("sfc64", 5)() == random::engines::sfc64{5}());
+    CHECK_THROWS_AS(random::any_engine::from_name("mt19937", 0), std::invalid_argument);
+  }
+
+  SUBCASE("copies are independent") {
+    auto a = random::any_engine{};
+    a();
+    auto b = a;
+    CHECK(a() == b());
+    a();
+    auto c = random::any_engine{random::engines::jsf32{}};
+    c = a;
+    CHECK(c() == a());
+    CHECK(c.type() == typeid(random::engines::jsf64));
+  }
+
+  SUBCASE("user engines and distributions") {
+    // a 16-bit engine, and one whose range is not a power of two
+    for (auto any : {random::any_engine{narrow_engine{}}, random::any_engine{std::minstd_rand{}}}) {
+      auto coin = random::distributions::uniform<bool>{};
+      auto heads = 0;
+      for (int i = 0; i < 10000; ++i) { heads += coin(any) ? 1 : 0; }
+      CHECK(heads > 4800);
+      CHECK(heads < 5200);
+    }
+
+    auto rng = random::rng{random::any_engine::from_name("jsf64", 0)};
+    const auto x = rng.random<double>(1.0, 2.0);
+    CHECK(x >= 1.0);
+    CHECK(x < 2.0);
+  }
+}
@@ -0,0 +1,107 @@
+#include <doctest/doctest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <span>
+
+#include "mattsep/random/random.hpp"
+
+namespace {
+  namespace random = mattsep::random;
+
+  // Each table is computed once by the compiler and once at run time by the same function.
+
+  constexpr auto zobrist_table() {
+    auto rng = random::rng{random::engines::jsf64{0x5EED}};
+    auto table = std::array<std::uint64_t, 64>{};
+    for (auto& x : table) { x = rng.random<std::uint64_t>(); }
+    return table;
+  }
+
+  constexpr auto permutation() {
+    auto rng = random::rng{random::engines::sfc32{42}};
+    auto p = std::array<int, 32>{};
+    for (std::size_t i = 0; i < p.size(); ++i) { p[i] = static_cast<int>(i); }
+    for (auto i = p.size() - 1; i > 0; --i) {
+      auto j = rng.random<std::size_t>(std::size_t{0}, i);
+      auto t = p[i];
+      p[i] = p[j];
+      p[j] = t;
+    }
+    return p;
+  }
+
+  constexpr auto bulk_values() {
+    auto rng = random::rng{};
+    auto ints = std::array<int, 100>{};
+    auto reals = std::array<float, 101>{};
+    auto bytes = std::array<std::byte, 37>{};
+    rng.fill(std::span<int>{ints}, -5, 5);
+    rng.fill(std::span<float>{reals}, -1.0f, 1.0f);
+    rng.fill_bytes(bytes);
+
+    auto checksum = std::uint64_t{0};
+    for (auto x : ints) { checksum = checksum * 31 + static_cast<std::uint64_t>(x + 5); }
+    for (auto x : reals) { checksum = checksum * 31 + static_cast<std::uint64_t>(x * 1000 + 1000); }
+    for (auto x : bytes) { checksum = checksum * 31 + static_cast<std::uint64_t>(x); }
+    return checksum;
+  }
+
+  constexpr auto distribution_values() {
+    auto engine = random::engines::pooled<random::engines::philox4x64>{};
+    auto values = std::array<double, 12>{};
+    values[0] = random::distributions::normal<double>{1.0, 2.0}(engine);
+    values[1] = random::distributions::exponential<double>{0.5}(engine);
+    values[2] = random::distributions::uniform<double>{-3.0, 3.0}(engine);
+    values[3] = random::distributions::uniform_full<double>{}(engine);
+    values[4] = random::distributions::bernoulli{0.3}(engine) ? 1.0 : 0.0;
+    values[5] = random::distributions::uniform<bool>{}(engine) ? 1.0 : 0.0;
+    values[6] = random::distributions::discrete<int>{1.0, 2.0, 3.0}(engine);
+    values[7] = static_cast<double>(random::distributions::uniform<std::uint8_t>{}(engine));
+    values[8] = random::distributions::binomial<int>{20, 0.3}(engine);
+    values[9] = random::distributions::binomial<int>{500, 0.3}(engine);
+    values[10] = random::distributions::poisson<int>{2.5}(engine);
+    values[11] = random::distributions::poisson<int>{250.0}(engine);
+    return values;
+  }
+
+  constexpr auto normal_values() {
+    auto engine = random::engines::jsf64{0x5EED};
+    auto values = std::array<double, 4>{};
+    random::distributions::normal<double>{}.generate(engine, values);
+    return values;
+  }
+
+  constexpr auto zobrist = zobrist_table();
+  constexpr auto shuffled = permutation();
+  constexpr auto checksum = bulk_values();
+  constexpr auto sampled = distribution_values();
+
+  // compile-time output agrees with the values checked at run time elsewhere in the suite
+  static_assert(normal_values()[0] == 0.38320092961273788);
+  static_assert(normal_values()[1] == 1.1705631566397783);
+  static_assert(normal_values()[2] == 0.65007364128182799);
+  static_assert(normal_values()[3] == 0.76759649384363093);
+
+  static_assert(zobrist[0] != zobrist[1]);
+  static_assert(random::engines::jsf64{0x5EED}() == zobrist[0]);
+  static_assert(random::engines::philox4x64{}[0] == random::engines::philox4x64{}());
+}  // namespace
+
+// NOLINTNEXTLINE
+TEST_CASE("mattsep::random (constexpr)") {
+  SUBCASE("compile-time and run-time output agree") {
+    CHECK((zobrist == zobrist_table()));
+    CHECK((shuffled == permutation()));
+    CHECK(checksum == bulk_values());
+    CHECK((sampled == distribution_values()));
+  }
+
+  SUBCASE("compile-time permutations are permutations") {
+    auto seen = std::array<bool, 32>{};
+    for (auto x : shuffled) { seen[static_cast<std::size_t>(x)] = true; }
+    for (auto x : seen) { CHECK(x); }
+  }
+}
@@ -0,0 +1,84 @@
+#include "mattsep/random/distributions/bernoulli.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+
+#include "mattsep/random/engines.hpp"
+
+namespace {
+  struct counting_engine {
+    using result_type = std::uint64_t;
+
+    mattsep::random::engines::jsf64 engine = {};
+    unsigned long long calls = 0;
+
+    auto operator()() -> result_type {
+      ++calls;
+      return engine();
+    }
+
+    static constexpr auto min() -> result_type {
+      return 0;
+    }
+
+    static constexpr auto max() -> result_type {
+      return ~result_type{0};
+    }
+  };
+}  // namespace
+
+// NOLINTNEXTLINE
+TEST_CASE("mattsep::random::distributions::bernoulli") {
+  auto engine = mattsep::random::default_random_engine{};
+  auto pooled = mattsep::random::engines::pooled<counting_engine>{};
+
+  SUBCASE("frequencies") {
+    for (auto p : {0.5, 0.3, 0.999, 1e-3}) {
+      auto dist = mattsep::random::distributions::bernoulli{p};
+      const auto n = 200000;
+      auto hits = 0;
+      auto pooled_hits = 0;
+      for (int i = 0; i < n; ++i) {
+        hits += dist(engine) ? 1 : 0;
+        pooled_hits += dist(pooled) ? 1 : 0;
+      }
+
+      const auto expected = p * n;
+      const auto tolerance = 5 * std::sqrt(n * p * (1 - p));
+      CHECK(std::abs(hits - expected) < tolerance);
+      CHECK(std::abs(pooled_hits - expected) < tolerance);
+    }
+  }
+
+  SUBCASE("about two bits per draw") {
+    auto dist = mattsep::random::distributions::bernoulli{0.3};
+    const auto n = 64000;
+    const auto before = pooled.engine().calls;
+    for (int i = 0; i < n; ++i) { dist(pooled); }
+    const auto bits = 64.0 * static_cast<double>(pooled.engine().calls - before) / n;
+    CHECK(bits > 1.9);
+    CHECK(bits < 2.1);
+  }
+
+  SUBCASE("edge cases") {
+    auto never = mattsep::random::distributions::bernoulli{0.0};
+    auto always = mattsep::random::distributions::bernoulli{1.0};
+    auto tiny = mattsep::random::distributions::bernoulli{1e-300};
+    for (int i = 0; i < 1000; ++i) {
+      CHECK_FALSE(never(engine));
+      CHECK_FALSE(never(pooled));
+      CHECK(always(engine));
+      CHECK(always(pooled));
+      CHECK_FALSE(tiny(engine));
+      CHECK_FALSE(tiny(pooled));
+    }
+
+    CHECK(mattsep::random::distributions::bernoulli{}.p() == 0.5);
+    CHECK_THROWS_AS(mattsep::random::distributions::bernoulli{1.5}, std::invalid_argument);
+    CHECK_THROWS_AS(mattsep::random::distributions::bernoulli{-0.1}, std::invalid_argument);
+  }
+}
@@ -0,0 +1,95 @@
+#include "mattsep/random/distributions/binomial.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "mattsep/random/concepts.hpp"
+#include "mattsep/random/engines.hpp"
+
+namespace {
+  // Checks the frequency of every value with probability above 1e-3 to within 5 standard errors.
+  template <class Dist>
+  auto check_frequencies(Dist dist, int n, double p) -> void {
+    auto engine = mattsep::random::default_random_engine{};
+    constexpr int draws = 200000;
+
+    auto counts = std::vector<int>(static_cast<std::size_t>(n) + 1);
+    for (int i = 0; i < draws; ++i) {
+      const auto k = dist(engine);
+      REQUIRE(k >= 0);
+      REQUIRE(k <= n);
+      ++counts[static_cast<std::size_t>(k)];
+    }
+
+    for (int k = 0; k <= n; ++k) {
+      const auto log_pmf = std::lgamma(n + 1.0) - std::lgamma(k + 1.0) - std::lgamma(n - k + 1.0) +
+                           k * std::log(p) + (n - k) * std::log1p(-p);
+      const auto pmf = std::exp(log_pmf);
+      if (pmf < 1e-3) { continue; }
+      const auto expected = draws * pmf;
+      const auto error = std::sqrt(expected * (1.0 - pmf));
+      CHECK(std::fabs(counts[static_cast<std::size_t>(k)] - expected) < 5.0 * error);
+    }
+  }
+}  // namespace
+
+// NOLINTNEXTLINE
+TEST_CASE("mattsep::random::distributions::binomial") {
+  namespace random = mattsep::random;
+
+  static_assert(random::random_number_distribution<random::distributions::binomial<int>>);
+  static_assert(random::random_number_distribution<random::distributions::binomial<long>>);
+
+  SUBCASE("parameters") {
+    auto dist = random::distributions::binomial<int>{10, 0.25};
+    CHECK(dist.n() == 10);
+    CHECK(dist.p() == 0.25);
+    CHECK(dist.min() == 0);
+    CHECK(dist.max() == 10);
+    CHECK(dist.param() == random::distributions::binomial<int>::param_type{10, 0.25});
+    CHECK_THROWS_AS(random::distributions::binomial<int>(-1, 0.5), std::invalid_argument);
+    CHECK_THROWS_AS(random::distributions::binomial<int>(5, 1.5), std::invalid_argument);
+  }
+
+  SUBCASE("degenerate cases") {
+    auto engine = random::default_random_engine{};
+    for (int i = 0; i < 100; ++i) {
+      CHECK(random::distributions::binomial<int>{7, 0.0}(engine) == 0);
+      CHECK(random::distributions::binomial<int>{7, 1.0}(engine) == 7);
+      CHECK(random::distributions::binomial<int>{0, 0.5}(engine) == 0);
+    }
+  }
+
+  SUBCASE("inversion") {
+    check_frequencies(random::distributions::binomial<int>{20, 0.3}, 20, 0.3);
+    check_frequencies(random::distributions::binomial<int>{20, 0.8}, 20, 0.8);
+    check_frequencies(random::distributions::binomial<int>{3, 0.5}, 3, 0.5);
+  }
+
+  SUBCASE("transformed rejection") {
+    check_frequencies(random::distributions::binomial<int>{100, 0.3}, 100, 0.3);
+    check_frequencies(random::distributions::binomial<int>{1000, 0.97}, 1000, 0.97);
+    check_frequencies(random::distributions::binomial<int>{40, 0.5}, 40, 0.5);
+  }
+
+  SUBCASE("large parameters") {
+    auto engine = random::default_random_engine{};
+    auto dist = random::distributions::binomial<long>{4'000'000'000, 0.25};
+
+    constexpr int draws = 100000;
+    auto sum = 0.0, sum2 = 0.0;
+    for (int i = 0; i < draws; ++i) {
+      const auto x = static_cast<double>(dist(engine));
+      sum += x;
+      sum2 += x * x;
+    }
+    const auto mean = sum / draws;
+    const auto variance = sum2 / draws - mean * mean;
+    CHECK(std::fabs(mean - 1e9) < 5.0 * std::sqrt(7.5e8 / draws));
+    CHECK(std::fabs(variance / 7.5e8 - 1.0) < 0.03);
+  }
+}
@@ -0,0 +1,67 @@
+#include "mattsep/random/distributions/discrete.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "mattsep/random/concepts.hpp"
+#include "mattsep/random/engines.hpp"
+
+// NOLINTNEXTLINE
+TEST_CASE("mattsep::random::distributions::discrete") {
+  namespace random = mattsep::random;
+  using random::distributions::discrete;
+
+  static_assert(random::random_number_distribution<discrete<int>>);
+
+  auto engine = random::default_random_engine{};
+
+  SUBCASE("frequencies follow the weights") {
+    auto dist = discrete<int>{1.0, 2.0, 0.0, 3.0, 4.0};
+    CHECK(dist.min() == 0);
+    CHECK(dist.max() == 4);
+
+    constexpr auto n = 1'000'000;
+    auto counts = std::vector<int>(5);
+    auto values = std::vector<int>(n);
+    dist.generate(engine, values);
+    for (auto x : values) { ++counts[static_cast<std::size_t>(x)]; }
+
+    CHECK(counts[2] == 0);
+    const auto& p = dist.probabilities();
+    for (std::size_t i = 0; i < counts.size(); ++i) {
+      const auto expected = p[i] * n;
+      CHECK(std::fabs(counts[i] - expected) <= 5.0 * std::sqrt(expected) + 1.0);
+    }
+  }
+
+  SUBCASE("many weights") {
+    auto weights = std::vector<double>(1000);
+    for (std::size_t i = 0; i < weights.size(); ++i) { weights[i] = static_cast<double>(i % 7); }
+    auto dist = discrete<std::size_t>{weights};
+
+    auto counts = std::vector<int>(weights.size());
+    for (int i = 0; i < 3'000'000; ++i) { ++counts[dist(engine)]; }
+
+    auto sevens = 0, zeros = 0;
+    for (std::size_t i = 0; i < weights.size(); ++i) {
+      if (weights[i] == 0.0) { zeros += counts[i]; }
+      if (weights[i] == 6.0) { sevens += counts[i]; }
+    }
+    CHECK(zeros == 0);
+    // the weight-6 outcomes hold 6/21 of the total mass
+    CHECK(std::fabs(sevens / 3e6 - 6.0 / 21.0) < 0.002);
+  }
+
+  SUBCASE("degenerate and invalid weights") {
+    auto single = discrete<int>{};
+    CHECK(single(engine) == 0);
+
+    CHECK_THROWS_AS(discrete<int>({0.0, 0.0}), std::invalid_argument);
+    CHECK_THROWS_AS(discrete<int>({1.0, -1.0}), std::invalid_argument);
+  }
+}
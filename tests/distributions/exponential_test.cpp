@@ -0,0 +1,52 @@
+#include "mattsep/random/distributions/exponential.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "mattsep/random/concepts.hpp"
+#include "mattsep/random/engines.hpp"
+
+// NOLINTNEXTLINE
+TEST_CASE("mattsep::random::distributions::exponential") {
+  namespace random = mattsep::random;
+
+  static_assert(random::random_number_distribution<random::distributions::exponential<double>>);
+
+  SUBCASE("moments") {
+    auto engine = random::default_random_engine{};
+    auto dist = random::distributions::exponential<double>{4.0};
+
+    constexpr auto n = 1'000'000;
+    auto sum = 0.0, sum2 = 0.0;
+    auto tail = 0;
+    for (int i = 0; i < n; ++i) {
+      const auto x = dist(engine);
+      REQUIRE(x >= 0.0);
+      sum += x;
+      sum2 += x * x;
+      tail += x > 7.69711747013104972 / 4.0;
+    }
+
+    const auto mean = sum / n;
+    const auto variance = sum2 / n - mean * mean;
+    CHECK(std::fabs(mean - 0.25) < 0.002);
+    CHECK(std::fabs(variance - 0.0625) < 0.001);
+
+    // P(X > r) is about 4.54e-4 for the tail boundary r of the ziggurat
+    CHECK(tail > 340);
+    CHECK(tail < 580);
+  }
+
+  SUBCASE("bulk generation matches scalar draws") {
+    auto engine = random::default_random_engine{};
+    auto expected = engine;
+    auto dist = random::distributions::exponential<double>{0.5};
+
+    auto values = std::vector<double>(1000);
+    dist.generate(engine, values);
+    for (auto x : values) { CHECK(x == dist(expected)); }
+  }
+}
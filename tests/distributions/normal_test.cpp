@@ -0,0 +1,64 @@
+#include "mattsep/random/distributions/normal.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "mattsep/random/concepts.hpp"
+#include "mattsep/random/engines.hpp"
+
+// NOLINTNEXTLINE
+TEST_CASE("mattsep::random::distributions::normal") {
+  namespace random = mattsep::random;
+
+  static_assert(random::random_number_distribution<random::distributions::normal<double>>);
+  static_assert(random::random_number_distribution<random::distributions::normal<float>>);
+
+  SUBCASE("moments") {
+    auto engine = random::default_random_engine{};
+    auto dist = random::distributions::normal<double>{2.0, 3.0};
+
+    constexpr auto n = 1'000'000;
+    auto sum = 0.0, sum2 = 0.0;
+    auto tail = 0;
+    for (int i = 0; i < n; ++i) {
+      const auto x = dist(engine);
+      sum += x;
+      sum2 += x * x;
+      tail += std::fabs(x - 2.0) > 3.0 * 3.6541528853610088;
+    }
+
+    const auto mean = sum / n;
+    const auto variance = sum2 / n - mean * mean;
+    CHECK(std::fabs(mean - 2.0) < 0.01);
+    CHECK(std::fabs(variance - 9.0) < 0.05);
+
+    // P(|Z| > r) is about 2.58e-4 for the tail boundary r of the ziggurat
+    CHECK(tail > 150);
+    CHECK(tail < 400);
+  }
+
+  SUBCASE("bulk generation matches scalar draws") {
+    auto engine = random::default_random_engine{};
+    auto expected = engine;
+    auto dist = random::distributions::normal<float>{-1.0f, 0.5f};
+
+    auto values = std::vector<float>(1000);
+    dist.generate(engine, values);
+    for (auto x : values) { CHECK(x == dist(expected)); }
+  }
+
+  SUBCASE("reproducible output") {
+    auto engine = random::engines::jsf64{0x5EED};
+    auto dist = random::distributions::normal<double>{};
+    auto values = std::vector<double>(4);
+    dist.generate(engine, values);
+
+    CHECK(values[0] == 0.38320092961273788);
+    CHECK(values[1] == 1.1705631566397783);
+    CHECK(values[2] == 0.65007364128182799);
+    CHECK(values[3] == 0.76759649384363093);
+  }
+}
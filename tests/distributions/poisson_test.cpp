@@ -0,0 +1,84 @@
+#include "mattsep/random/distributions/poisson.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <map>
+#include <stdexcept>
+
+#include "mattsep/random/concepts.hpp"
+#include "mattsep/random/engines.hpp"
+
+namespace {
+  // Checks the frequency of every value with probability above 1e-3 to within 5 standard errors.
+  auto check_frequencies(double mean) -> void {
+    auto engine = mattsep::random::default_random_engine{};
+    auto dist = mattsep::random::distributions::poisson<int>{mean};
+    constexpr int draws = 200000;
+
+    auto counts = std::map<int, int>{};
+    for (int i = 0; i < draws; ++i) {
+      const auto k = dist(engine);
+      REQUIRE(k >= 0);
+      ++counts[k];
+    }
+
+    const auto limit = static_cast<int>(mean + 10.0 * std::sqrt(mean) + 10.0);
+    for (int k = 0; k <= limit; ++k) {
+      const auto pmf = std::exp(k * std::log(mean) - mean - std::lgamma(k + 1.0));
+      if (pmf < 1e-3) { continue; }
+      const auto expected = draws * pmf;
+      const auto error = std::sqrt(expected * (1.0 - pmf));
+      CHECK(std::fabs(counts[k] - expected) < 5.0 * error);
+    }
+  }
+}  // namespace
+
+// NOLINTNEXTLINE
+TEST_CASE("mattsep::random::distributions::poisson") {
+  namespace random = mattsep::random;
+
+  static_assert(random::random_number_distribution<random::distributions::poisson<int>>);
+
+  SUBCASE("parameters") {
+    auto dist = random::distributions::poisson<int>{3.5};
+    CHECK(dist.mean() == 3.5);
+    CHECK(dist.min() == 0);
+    CHECK(dist.param() == random::distributions::poisson<int>::param_type{3.5});
+    CHECK_THROWS_AS(random::distributions::poisson<int>(-1.0), std::invalid_argument);
+
+    auto engine = random::default_random_engine{};
+    auto zero = random::distributions::poisson<int>{0.0};
+    for (int i = 0; i < 100; ++i) { CHECK(zero(engine) == 0); }
+  }
+
+  SUBCASE("inversion") {
+    check_frequencies(0.01);
+    check_frequencies(1.0);
+    check_frequencies(9.9);
+  }
+
+  SUBCASE("transformed rejection") {
+    check_frequencies(10.0);
+    check_frequencies(37.5);
+    check_frequencies(1000.0);
+  }
+
+  SUBCASE("large means") {
+    auto engine = random::default_random_engine{};
+    auto dist = random::distributions::poisson<long>{1e9};
+
+    constexpr int draws = 100000;
+    auto sum = 0.0, sum2 = 0.0;
+    for (int i = 0; i < draws; ++i) {
+      const auto x = static_cast<double>(dist(engine));
+      sum += x;
+      sum2 += x * x;
+    }
+    const auto mean = sum / draws;
+    const auto variance = sum2 / draws - mean * mean;
+    CHECK(std::fabs(mean - 1e9) < 5.0 * std::sqrt(1e9 / draws));
+    CHECK(std::fabs(variance / 1e9 - 1.0) < 0.03);
+  }
+}
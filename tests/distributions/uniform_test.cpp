@@ -0,0 +1,280 @@
+#include "mattsep/random/distributions/uniform.hpp"
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "mattsep/random/engines.hpp"
+
+namespace {
+  // Draws from @a dist both one at a time and in bulk, checking the bounds and that each half of
+  // the range gets about half of the values.
+  template <class Distribution, class Engine>
+  auto check_fixed(Distribution dist, Engine& engine) -> void {
+    using T = typename Distribution::result_type;
+    const auto min = static_cast<double>(dist.min());
+    const auto mid = min + (static_cast<double>(dist.max()) - min + 1) / 2;
+
+    auto values = std::vector<T>(20000);
+    for (std::size_t i = 0; i < values.size() / 2; ++i) { values[i] = dist(engine); }
+    dist.generate(engine, std::span{values}.subspan(values.size() / 2));
+
+    auto low = 0;
+    for (auto x : values) {
+      REQUIRE(dist.min() <= x);
+      REQUIRE(x <= dist.max());
+      if (static_cast<double>(x) < mid) { ++low; }
+    }
+    if (dist.min() != dist.max()) {
+      CHECK(low > 9600);
+      CHECK(low < 10400);
+    }
+  }
+}  // namespace
+
+// NOLINTNEXTLINE
+TEST_CASE("mattsep::random::distributions::uniform") {
+  auto engine = mattsep::random::default_random_engine{};
+
+  SUBCASE("bulk integer generation") {
+    auto dist = mattsep::random::distributions::uniform<int>{1, 6};
+    auto values = std::vector<int>(6000);
+    dist.generate(engine, values);
+
+    auto counts = std::array<int, 6>{};
+    for (auto x : values) {
+      REQUIRE(1 <= x);
+      REQUIRE(x <= 6);
+      ++counts[static_cast<std::size_t>(x - 1)];
+    }
+    for (auto c : counts) { CHECK(c > 800); }
+  }
+
+  SUBCASE("bulk generation across batch sizes") {
+    // ranges chosen to give batches of 16, 4, 3, 2 and 1 values per word
+    for (auto range : {std::uint64_t{10}, std::uint64_t{40000}, std::uint64_t{2000000},
+                       std::uint64_t{1} << 32, (std::uint64_t{1} << 32) + 1}) {
+      auto dist = mattsep::random::distributions::uniform<std::uint64_t>{5, 5 + range - 1};
+      auto values = std::vector<std::uint64_t>(20001);
+      dist.generate(engine, values);
+
+      auto low = std::size_t{0};
+      for (auto x : values) {
+        REQUIRE(5 <= x);
+        REQUIRE(x <= 5 + range - 1);
+        if (x - 5 < range / 2) { ++low; }
+      }
+      CHECK(low > 9600);
+      CHECK(low < 10400);
+    }
+  }
+
+  SUBCASE("batched values are unbiased when rejection is needed") {
+    // 3 * 3^39 is close to 2^64 / 1.5, so about a third of all words are rejected; a biased
+    // implementation would favour the low residues
+    auto bounds = std::array<std::uint64_t, 40>{};
+    bounds.fill(3);
+    auto product = std::uint64_t{1};
+    for (auto b : bounds) { product *= b; }
+    const auto threshold = mattsep::random::internal::batch_threshold(product);
+    CHECK(threshold > 0);
+
+    auto out = std::array<std::uint64_t, 40>{};
+    auto counts = std::array<int, 3>{};
+    for (int i = 0; i < 3000; ++i) {
+      mattsep::random::internal::bounded_batch(engine, bounds, out, threshold);
+      for (auto x : out) {
+        REQUIRE(x < 3);
+        ++counts[x];
+      }
+    }
+    for (auto c : counts) {
+      CHECK(c > 39400);
+      CHECK(c < 40600);
+    }
+  }
+
+  SUBCASE("small types use the full range") {
+    auto dist = mattsep::random::distributions::uniform<std::uint8_t>{};
+    CHECK(dist.min() == 0);
+    CHECK(dist.max() == 255);
+    auto values = std::vector<std::uint8_t>(2000);
+    dist.generate(engine, values);
+    CHECK(std::any_of(values.begin(), values.end(), [](auto x) { return x >= 128; }));
+
+    auto bounded = mattsep::random::distributions::uniform<std::int8_t>{-3, 3};
+    CHECK(bounded.param() == decltype(bounded)::param_type{-3, 3});
+    for (int i = 0; i < 1000; ++i) {
+      auto x = bounded(engine);
+      REQUIRE(-3 <= x);
+      REQUIRE(x <= 3);
+    }
+  }
+
+  SUBCASE("signed ranges wider than the type's maximum") {
+    constexpr auto int_min = std::numeric_limits<int>::min();
+    constexpr auto int_max = std::numeric_limits<int>::max();
+    constexpr auto long_max = std::numeric_limits<std::int64_t>::max();
+
+    auto dist = mattsep::random::distributions::uniform<int>{-1, int_max};
+    auto values = std::vector<int>(1000);
+    dist.generate(engine, values);
+    values.push_back(dist(engine));
+    CHECK(std::all_of(values.begin(), values.end(), [](int x) { return x >= -1; }));
+    CHECK(std::any_of(values.begin(), values.end(), [](int x) { return x > int_max / 2; }));
+
+    auto low = mattsep::random::distributions::uniform<int>{int_min, 1};
+    low.generate(engine, values);
+    CHECK(std::all_of(values.begin(), values.end(), [](int x) { return x <= 1; }));
+    CHECK(std::any_of(values.begin(), values.end(), [](int x) { return x < int_min / 2; }));
+
+    auto wide = mattsep::random::distributions::uniform<std::int64_t>{-2, long_max};
+    auto wide_values = std::vector<std::int64_t>(1000);
+    wide.generate(engine, wide_values);
+    wide_values.push_back(wide(engine));
+    CHECK(std::all_of(wide_values.begin(), wide_values.end(), [](auto x) { return x >= -2; }));
+    CHECK(std::any_of(wide_values.begin(), wide_values.end(),
+                      [](auto x) { return x > long_max / 2; }));
+
+    auto full = mattsep::random::distributions::uniform<int>{};
+    full.generate(engine, values);
+    values.push_back(full(engine));
+    CHECK(std::any_of(values.begin(), values.end(), [](int x) { return x < 0; }));
+  }
+
+  SUBCASE("bulk full-range generation") {
+    auto dist = mattsep::random::distributions::uniform<std::uint32_t>{};
+    auto values = std::vector<std::uint32_t>(1000);
+    dist.generate(engine, values);
+    CHECK(std::any_of(values.begin(), values.end(), [](auto x) { return x >= (1u << 31); }));
+  }
+
+  SUBCASE("bulk floating-point generation") {
+    auto dist = mattsep::random::distributions::uniform<double>{};
+    auto values = std::vector<double>(1000);
+    dist.generate(engine, values);
+    CHECK(std::all_of(values.begin(), values.end(), [](double x) { return 0.0 <= x && x < 1.0; }));
+
+    // values are built from 52 mantissa bits
+    CHECK(std::all_of(values.begin(), values.end(), [](double x) {
+      return std::ldexp(x, 52) == std::floor(std::ldexp(x, 52));
+    }));
+  }
+
+  SUBCASE("floating-point ranges are half-open") {
+    for (auto [a, b] : {std::pair{-1.0, 3.0}, std::pair{-2.0, -1.0}, std::pair{1e-300, 2e-300}}) {
+      auto dist = mattsep::random::distributions::uniform<double>{a, b};
+      CHECK(dist.min() == a);
+      CHECK(dist.max() == b);
+
+      auto values = std::vector<double>(1000);
+      dist.generate(engine, values);
+      for (auto x : values) {
+        REQUIRE(a <= x);
+        REQUIRE(x < b);
+      }
+      for (int i = 0; i < 1000; ++i) {
+        auto x = dist(engine);
+        REQUIRE(a <= x);
+        REQUIRE(x < b);
+      }
+    }
+
+    // a range one ulp wide; a + (b - a) * u rounds to b for most u and must be clamped
+    const auto b = std::nextafter(1.0f, 2.0f);
+    auto dist = mattsep::random::distributions::uniform<float>{1.0f, b};
+    auto values = std::vector<float>(100);
+    dist.generate(engine, values);
+    CHECK(std::all_of(values.begin(), values.end(), [](float x) { return x == 1.0f; }));
+    CHECK(dist(engine) == 1.0f);
+  }
+
+  SUBCASE("two floats per engine word") {
+    auto dist = mattsep::random::distributions::uniform<float>{-1.0f, 1.0f};
+    auto copy = engine;
+
+    auto values = std::vector<float>(1001);
+    dist.generate(engine, values);
+    copy.discard(501);
+    CHECK(engine == copy);
+
+    auto sum = 0.0;
+    for (auto x : values) {
+      REQUIRE(-1.0f <= x);
+      REQUIRE(x < 1.0f);
+      sum += static_cast<double>(x);
+    }
+    CHECK(std::abs(sum / static_cast<double>(values.size())) < 0.1);
+  }
+
+  SUBCASE("full-precision floating-point generation") {
+    auto dist = mattsep::random::distributions::uniform_full<double>{};
+
+    auto tiny = 0;
+    auto off_grid = 0;
+    auto sum = 0.0;
+    for (int i = 0; i < 100000; ++i) {
+      auto x = dist(engine);
+      REQUIRE(0.0 <= x);
+      REQUIRE(x < 1.0);
+      sum += x;
+      if (x < 0x1p-10) { ++tiny; }
+      if (std::ldexp(x, 52) != std::floor(std::ldexp(x, 52))) { ++off_grid; }
+    }
+    CHECK(std::abs(sum / 100000 - 0.5) < 0.01);
+    CHECK(tiny > 50);
+    CHECK(tiny < 150);
+    CHECK(off_grid > 0);
+
+    auto single = mattsep::random::distributions::uniform_full<float>{};
+    for (int i = 0; i < 1000; ++i) {
+      auto x = single(engine);
+      REQUIRE(0.0f <= x);
+      REQUIRE(x < 1.0f);
+    }
+  }
+
+  SUBCASE("compile-time ranges") {
+    namespace distributions = mattsep::random::distributions;
+    constexpr auto int_min = std::numeric_limits<int>::min();
+    constexpr auto int_max = std::numeric_limits<int>::max();
+
+    check_fixed(distributions::uniform_fixed<int, 1, 6>{}, engine);
+    check_fixed(distributions::uniform_fixed<int, 0, 51>{}, engine);
+    check_fixed(distributions::uniform_fixed<int, 0, 1023>{}, engine);
+    check_fixed(distributions::uniform_fixed<int, -5, -5>{}, engine);
+    check_fixed(distributions::uniform_fixed<int, -2'000'000'000, 2'000'000'000>{}, engine);
+    check_fixed(distributions::uniform_fixed<int, int_min, int_max>{}, engine);
+    check_fixed(distributions::uniform_fixed<std::int8_t, -128, 127>{}, engine);
+    check_fixed(distributions::uniform_fixed<std::uint16_t, 7, 1000>{}, engine);
+    check_fixed(distributions::uniform_fixed<std::uint64_t, 3, (std::uint64_t{1} << 40) + 2>{},
+                engine);
+    check_fixed(distributions::uniform_fixed<std::uint64_t, 0, (std::uint64_t{1} << 62) - 1>{},
+                engine);
+  }
+
+  SUBCASE("compile-time ranges draw 32 bits where they fit") {
+    auto small = mattsep::random::engines::jsf32{};
+    auto copy = small;
+
+    // a power of two is the top bits of a single output
+    auto bits = mattsep::random::distributions::uniform_fixed<int, 0, 1023>{};
+    for (int i = 0; i < 100; ++i) { CHECK(bits(small) == static_cast<int>(copy() >> 22)); }
+
+    // 2^32 mod 6 is 4, so a rejection here is all but impossible
+    auto die = mattsep::random::distributions::uniform_fixed<int, 1, 6>{};
+    for (int i = 0; i < 100; ++i) {
+      const auto x = die(small);
+      CHECK(x == 1 + static_cast<int>((std::uint64_t{copy()} * 6) >> 32));
+    }
+    CHECK(small == copy);
+  }
+}
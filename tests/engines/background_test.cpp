@@ -0,0 +1,47 @@
+#include "mattsep/random/engines/background.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cstddef>
+#include <iostream>
+#include <thread>
+
+#include "mattsep/random/concepts.hpp"
+#include "mattsep/random/engines/jsf.hpp"
+#include "mattsep/random/engines/philox.hpp"
+
+// NOLINTNEXTLINE
+TEST_CASE("mattsep::random::engines::background") {
+  namespace engines = mattsep::random::engines;
+
+  static_assert(mattsep::random::uniform_random_bit_generator<engines::background<engines::jsf64>>);
+
+  SUBCASE("output matches the wrapped engine when the ring keeps up") {
+    constexpr std::size_t block_size = 16;
+    constexpr std::size_t blocks = 8;
+
+    auto background = engines::background<engines::jsf64, block_size, blocks>{engines::jsf64{0x5EED}};
+    while (background.available() < blocks) { std::this_thread::yield(); }
+
+    // The adapter splits its fallback engine off first, and then hands the engine to the producer.
+    auto expected = engines::jsf64{0x5EED};
+    expected.split();
+
+    for (std::size_t i = 0; i < block_size * blocks; ++i) { CHECK(background() == expected()); }
+    CHECK(background.stats().fallbacks == 0);
+    CHECK(background.stats().blocks == blocks);
+  }
+
+  SUBCASE("every draw is accounted for") {
+    constexpr std::size_t block_size = 4;
+
+    auto background = engines::background<engines::philox4x32, block_size, 2>{};
+    constexpr auto draws = 100'000ull;
+    for (auto i = 0ull; i < draws; ++i) { background(); }
+
+    const auto stats = background.stats();
+    const auto from_ring = draws - stats.fallbacks;
+    CHECK(from_ring <= stats.blocks * block_size);
+    CHECK(from_ring + block_size > stats.blocks * block_size);
+  }
+}
@@ -0,0 +1,152 @@
+#include "mattsep/random/engines/chacha.hpp"
+
+#include <doctest/doctest.h>
+
+#include "mattsep/random/concepts.hpp"
+#include "mattsep/random/rng.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+  namespace engines = mattsep::random::engines;
+
+  // the key 00 01 02 ... 1f of the RFC 8439 examples
+  constexpr auto rfc_key = engines::chacha20::key_type{0x03020100, 0x07060504, 0x0B0A0908,
+                                                       0x0F0E0D0C, 0x13121110, 0x17161514,
+                                                       0x1B1A1918, 0x1F1E1D1C};
+
+  // Checks every path of the engine against the block function, across several batches.
+  template <class Engine>
+  auto check_against_blocks(Engine engine) -> void {
+    const auto key = engine.key();
+    const auto stream = engine.stream();
+
+    auto expected = std::vector<std::uint64_t>{};
+    for (std::uint64_t n = 0; n < 40; ++n) {
+      const auto block = Engine::block(key, n, stream);
+      for (std::size_t k = 0; k < 8; ++k) {
+        expected.push_back(block[2 * k] | (std::uint64_t{block[2 * k + 1]} << 32));
+      }
+    }
+
+    auto scalar = engine;
+    for (auto x : expected) { CHECK(scalar() == x); }
+
+    // chunks that start and end part way through blocks and batches
+    auto bulk = engine;
+    auto values = std::vector<std::uint64_t>(expected.size());
+    auto out = std::span{values};
+    for (std::size_t chunk : {3u, 130u, 1u, 128u}) {
+      bulk.generate(out.first(chunk));
+      out = out.subspan(chunk);
+    }
+    bulk.generate(out);
+    CHECK((values == expected));
+    CHECK(bulk == scalar);
+  }
+}  // namespace
+
+// NOLINTNEXTLINE
+TEST_CASE("mattsep::random::engines::chacha") {
+  static_assert(mattsep::random::uniform_random_bit_generator<engines::chacha20>);
+  static_assert(mattsep::random::bulk_random_bit_generator<engines::chacha20>);
+
+  SUBCASE("RFC 8439 block function") {
+    // section 2.3.2: block counter 1, nonce 00:00:00:09:00:00:00:4a:00:00:00:00
+    constexpr auto block = engines::chacha20::block(rfc_key, 0x0900'0000'0000'0001, 0x4A00'0000);
+    static_assert(block == engines::chacha20::block_type{
+                               0xE4E7F110, 0x15593BD1, 0x1FDD0F50, 0xC47120A3, 0xC7F4D1C7,
+                               0x0368C033, 0x9AAA2204, 0x4E6CD4C3, 0x466482D2, 0x09AA9F07,
+                               0x05D7C214, 0xA2028BD9, 0xD19C12B5, 0xB94E16DE, 0xE883D0CB,
+                               0x4E3C50A2});
+  }
+
+  SUBCASE("RFC 8439 keystream") {
+    // section 2.4.2: block counter 1, nonce 00:00:00:00:00:00:00:4a:00:00:00:00
+    auto engine = engines::chacha20{rfc_key, 0x4A00'0000};
+    engine.seek(1);
+    auto rng = mattsep::random::rng{engine};
+    auto bytes = std::array<std::byte, 16>{};
+    rng.fill_bytes(bytes);
+
+    const auto expected = std::array<unsigned, 16>{0x22, 0x4F, 0x51, 0xF3, 0x40, 0x1B, 0xD9, 0xE1,
+                                                   0x2F, 0xDE, 0x27, 0x6F, 0xB8, 0x63, 0x1D, 0xED};
+    for (std::size_t i = 0; i < bytes.size(); ++i) {
+      CHECK(std::to_integer<unsigned>(bytes[i]) == expected[i]);
+    }
+  }
+
+  SUBCASE("batched blocks match the block function") {
+    check_against_blocks(engines::chacha8{0x5EED});
+    check_against_blocks(engines::chacha12{0x5EED, 3});
+    check_against_blocks(engines::chacha20{rfc_key, 0xFFFF'FFFF'0000'0001});
+  }
+
+  SUBCASE("seek and discard") {
+    const auto reference = engines::chacha20{0x5EED};
+
+    auto sought = reference;
+    sought.seek(5);
+    auto skipped = reference;
+    skipped.discard(40);
+    CHECK(sought == skipped);
+
+    for (auto n : {0ull, 1ull, 7ull, 127ull, 128ull, 1000ull, 1ull << 40}) {
+      auto slow = reference;
+      slow.discard(3);
+      auto fast = slow;
+      if (n < 2000) {
+        for (unsigned long long i = 0; i < n; ++i) { slow(); }
+      } else {
+        slow.seek((3 + n) / 8);
+        slow.discard((3 + n) % 8);
+      }
+      fast.discard(n);
+      CHECK(fast == slow);
+      CHECK(fast() == slow());
+    }
+
+    // the 64-bit block counter wraps around
+    auto end = reference;
+    end.seek(~std::uint64_t{0});
+    end.discard(8);
+    auto start = reference;
+    CHECK(end() == start());
+  }
+
+  SUBCASE("state") {
+    auto engine = engines::chacha12{0x5EED, 9};
+    engine.discard(1234);
+    auto copy = engines::chacha12::from_state(engine.state());
+    CHECK(copy == engine);
+    for (int i = 0; i < 200; ++i) { CHECK(copy() == engine()); }
+  }
+
+  SUBCASE("operating system keys") {
+    auto x = engines::chacha20{};
+    auto y = engines::chacha20{};
+    CHECK(x.key() != y.key());
+
+    auto rng = mattsep::random::rng<engines::chacha20>{};
+    auto values = std::vector<double>(1000);
+    rng.fill(std::span{values});
+    for (auto v : values) {
+      REQUIRE(0.0 <= v);
+      REQUIRE(v < 1.0);
+    }
+  }
+
+  SUBCASE("split") {
+    auto parent = engines::chacha20{0x5EED};
+    auto replay = parent;
+    auto child = parent.split();
+
+    auto words = std::array<std::uint64_t, 4>{};
+    replay.generate(words);
+    CHECK(parent == replay);
+    CHECK(child.key() != parent.key());
+  }
+}
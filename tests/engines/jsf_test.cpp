@@ -3,6 +3,7 @@
 #include <doctest/doctest.h>
 
 #include <iostream>
+#include <vector>
 
 // NOLINTNEXTLINE
 TEST_CASE("mattsep::random::engines::jsf") {
@@ -37,4 +38,40 @@ TEST_CASE("mattsep::random::engines::jsf") {
     jsf.discard((1ull << 20) + 1);
     CHECK(jsf() == 18419506965267833452ull);
   }
-}
\ No newline at end of file
+
+  SUBCASE("bulk generation") {
+    auto jsf = mattsep::random::engines::jsf64{0x5EED};
+    auto expected = jsf;
+
+    auto block = std::vector<mattsep::random::engines::jsf64::result_type>(1000);
+    jsf.generate(block);
+    for (auto x : block) { CHECK(x == expected()); }
+    CHECK(jsf == expected);
+  }
+
+  SUBCASE("streams") {
+    using engine_type = mattsep::random::engines::jsf64;
+
+    CHECK(engine_type{0x5EED, 0} == engine_type{0x5EED});
+    CHECK(engine_type{0x5EED, 1} != engine_type{0x5EED});
+
+    auto x = engine_type{0x5EED, 1};
+    auto y = engine_type{0x5EED, 2};
+    auto matches = 0;
+    for (int i = 0; i < 1000; ++i) { matches += (x() == y()); }
+    CHECK(matches == 0);
+  }
+
+  SUBCASE("split") {
+    auto parent = mattsep::random::engines::jsf64{0x5EED};
+    auto replay = parent;
+
+    auto child = parent.split();
+    CHECK(child == replay.split());
+    CHECK(parent == replay);
+
+    auto matches = 0;
+    for (int i = 0; i < 1000; ++i) { matches += (parent() == child()); }
+    CHECK(matches == 0);
+  }
+}
@@ -0,0 +1,30 @@
+#include "mattsep/random/engines/jsfx.hpp"
+
+#include <doctest/doctest.h>
+
+#include "mattsep/random/engines/jsf.hpp"
+
+#include "lane_checks.hpp"
+
+// NOLINTNEXTLINE
+TEST_CASE("mattsep::random::engines::jsfx") {
+  namespace engines = mattsep::random::engines;
+
+  SUBCASE("32-bit lanes match scalar generation") {
+    lane_checks::check_lanes_match_scalar<engines::jsf32x8, engines::jsf32>();
+    lane_checks::check_lanes_match_scalar<engines::jsf32x16, engines::jsf32>();
+    lane_checks::check_lanes_match_scalar_streams<engines::jsf32x8, engines::jsf32>();
+  }
+
+  SUBCASE("64-bit lanes match scalar generation") {
+    lane_checks::check_lanes_match_scalar<engines::jsf64x4, engines::jsf64>();
+    lane_checks::check_lanes_match_scalar<engines::jsf64x8, engines::jsf64>();
+    lane_checks::check_lanes_match_scalar_streams<engines::jsf64x4, engines::jsf64>();
+  }
+
+  SUBCASE("bulk generation") {
+    lane_checks::check_bulk_matches_scalar_calls<engines::jsf32x8>();
+    lane_checks::check_bulk_matches_scalar_calls<engines::jsf64x4>();
+    lane_checks::check_bulk_matches_scalar_calls<engines::jsf64x8>();
+  }
+}
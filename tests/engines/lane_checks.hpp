@@ -0,0 +1,64 @@
+#ifndef MATTSEP_RANDOM_TESTS_ENGINES_LANE_CHECKS_HPP_INCLUDED
+#define MATTSEP_RANDOM_TESTS_ENGINES_LANE_CHECKS_HPP_INCLUDED
+
+#include <doctest/doctest.h>
+
+#include <cstddef>
+#include <vector>
+
+// Checks shared by the multi-lane engines, jsfx and sfcx, against their scalar counterparts.
+namespace lane_checks {
+
+template <class Multi, class Scalar>
+auto check_lanes_match_scalar() -> void {
+  constexpr auto lanes = Multi::lanes;
+
+  auto seeds = typename Multi::block_type{};
+  for (std::size_t i = 0; i < lanes; ++i) {
+    seeds[i] = static_cast<typename Multi::result_type>(0x5EED * (i + 1));
+  }
+
+  auto multi = Multi{seeds};
+  auto scalars = std::vector<Scalar>{};
+  for (auto s : seeds) { scalars.emplace_back(s); }
+
+  for (int step = 0; step < 100; ++step) {
+    for (auto& scalar : scalars) { CHECK(multi() == scalar()); }
+  }
+}
+
+template <class Multi, class Scalar>
+auto check_lanes_match_scalar_streams() -> void {
+  auto multi = Multi{0x5EED};
+  auto scalars = std::vector<Scalar>{};
+  for (std::size_t i = 0; i < Multi::lanes; ++i) {
+    scalars.emplace_back(0x5EED, static_cast<typename Scalar::result_type>(i));
+  }
+
+  for (int step = 0; step < 100; ++step) {
+    for (auto& scalar : scalars) { CHECK(multi() == scalar()); }
+  }
+}
+
+template <class Multi>
+auto check_bulk_matches_scalar_calls() -> void {
+  auto multi = Multi{};
+  auto expected = multi;
+
+  for (auto size : {std::size_t{1}, std::size_t{3}, Multi::lanes, std::size_t{1001}}) {
+    auto block = std::vector<typename Multi::result_type>(size);
+    multi.generate(block);
+    for (auto x : block) { CHECK(x == expected()); }
+  }
+  CHECK(multi == expected);
+
+  multi.discard(1);
+  expected();
+  multi.discard(3 * Multi::lanes + 1);
+  for (std::size_t i = 0; i < 3 * Multi::lanes + 1; ++i) { expected(); }
+  CHECK(multi() == expected());
+}
+
+}  // namespace lane_checks
+
+#endif
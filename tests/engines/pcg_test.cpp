@@ -0,0 +1,85 @@
+#include "mattsep/random/engines/pcg.hpp"
+
+#include <doctest/doctest.h>
+
+#include "mattsep/random/concepts.hpp"
+
+#include <cstdint>
+#include <vector>
+
+// NOLINTNEXTLINE
+TEST_CASE("mattsep::random::engines::pcg") {
+  using engine_type = mattsep::random::engines::pcg64_dxsm;
+  static_assert(mattsep::random::uniform_random_bit_generator<engine_type>);
+
+  SUBCASE("reference output") {
+    auto pcg = engine_type{42, 54};
+    for (auto expected : {17331114245835578256ull, 10267467544499227306ull,
+                          9726600296081716989ull, 10165951391103677450ull,
+                          12131334649314727261ull, 10134094537930450875ull}) {
+      CHECK(pcg() == expected);
+    }
+  }
+
+  SUBCASE("64-bit generation") {
+    auto pcg = engine_type{};
+
+    pcg.seed(1);
+    pcg.discard((1ull << 20) + 1);
+    CHECK(pcg() == 7226192487705817384ull);
+
+    pcg.seed(0x5EED);
+    pcg.discard((1ull << 20) + 1);
+    CHECK(pcg() == 9844565071222085487ull);
+
+    pcg.seed(0xFFFF'FFFF'FFFF'FFFFull);
+    pcg.discard((1ull << 20) + 1);
+    CHECK(pcg() == 5351028668487673440ull);
+  }
+
+  SUBCASE("advance") {
+    auto slow = engine_type{0x5EED};
+    auto fast = slow;
+    for (int i = 0; i < 1000; ++i) { slow(); }
+    fast.advance(1000);
+    CHECK(slow == fast);
+    CHECK(fast() == 2417719582150512516ull);
+
+    // a full period returns to the start, and advancing by -n undoes advancing by n
+    auto start = engine_type{0x5EED, 3};
+    auto pcg = start;
+    pcg.advance(mattsep::random::internal::uint128_t{0} - 1);
+    pcg();
+    CHECK(pcg == start);
+
+    pcg.advance(12345);
+    pcg.advance(mattsep::random::internal::uint128_t{0} - 12345);
+    CHECK(pcg == start);
+  }
+
+  SUBCASE("bulk generation") {
+    auto pcg = engine_type{0x5EED};
+    auto expected = pcg;
+
+    auto block = std::vector<engine_type::result_type>(1000);
+    pcg.generate(block);
+    for (auto x : block) { CHECK(x == expected()); }
+    CHECK(pcg == expected);
+  }
+
+  SUBCASE("streams and split") {
+    CHECK(engine_type{0x5EED, 0} == engine_type{0x5EED});
+
+    auto x = engine_type{0x5EED, 1};
+    auto y = engine_type{0x5EED, 2};
+    auto matches = 0;
+    for (int i = 0; i < 1000; ++i) { matches += (x() == y()); }
+    CHECK(matches == 0);
+
+    auto parent = engine_type{0x5EED};
+    auto replay = parent;
+    auto child = parent.split();
+    CHECK(child == replay.split());
+    CHECK(parent == replay);
+  }
+}
@@ -0,0 +1,90 @@
+#include "mattsep/random/engines/philox.hpp"
+
+#include <doctest/doctest.h>
+
+#include "mattsep/random/concepts.hpp"
+
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+// NOLINTNEXTLINE
+TEST_CASE("mattsep::random::engines::philox") {
+  namespace engines = mattsep::random::engines;
+
+  static_assert(mattsep::random::uniform_random_bit_generator<engines::philox4x32>);
+  static_assert(mattsep::random::uniform_random_bit_generator<engines::philox4x64>);
+
+  // Known-answer vectors from the Random123 distribution.
+  SUBCASE("32-bit known answers") {
+    using engine_type = engines::philox4x32;
+
+    CHECK(engine_type::block({0, 0, 0, 0}, {0, 0})
+          == engine_type::counter_type{0x6627E8D5, 0xE169C58D, 0xBC57AC4C, 0x9B00DBD8});
+    CHECK(engine_type::block({0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF},
+                             {0xFFFFFFFF, 0xFFFFFFFF})
+          == engine_type::counter_type{0x408F276D, 0x41C83B0E, 0xA20BC7C6, 0x6D5451FD});
+    CHECK(engine_type::block({0x243F6A88, 0x85A308D3, 0x13198A2E, 0x03707344},
+                             {0xA4093822, 0x299F31D0})
+          == engine_type::counter_type{0xD16CFE09, 0x94FDCCEB, 0x5001E420, 0x24126EA1});
+  }
+
+  SUBCASE("64-bit known answers") {
+    using engine_type = engines::philox4x64;
+
+    CHECK(engine_type::block({0, 0, 0, 0}, {0, 0})
+          == engine_type::counter_type{0x16554D9ECA36314Cull, 0xDB20FE9D672D0FDCull,
+                                       0xD7E772CEE186176Bull, 0x7E68B68AEC7BA23Bull});
+    CHECK(engine_type::block({~0ull, ~0ull, ~0ull, ~0ull}, {~0ull, ~0ull})
+          == engine_type::counter_type{0x87B092C3013FE90Bull, 0x438C3C67BE8D0224ull,
+                                       0x9CC7D7C69CD777B6ull, 0xA09CAEBF594F0BA0ull});
+    CHECK(engine_type::block({0x243F6A8885A308D3ull, 0x13198A2E03707344ull,
+                              0xA4093822299F31D0ull, 0x082EFA98EC4E6C89ull},
+                             {0x452821E638D01377ull, 0xBE5466CF34E90C6Cull})
+          == engine_type::counter_type{0xA528F45403E61D95ull, 0x38C72DBD566E9788ull,
+                                       0xA5A1610E72FD18B5ull, 0x57BD43B5E52B7FE6ull});
+  }
+
+  SUBCASE("stream layout") {
+    auto philox = engines::philox4x32{0x5EED, 7};
+    const auto key = engines::philox4x32::key_type{0x5EED, 7};
+
+    for (unsigned counter = 0; counter < 3; ++counter) {
+      auto expected = engines::philox4x32::block({counter, 0, 0, 0}, key);
+      for (auto x : expected) { CHECK(philox() == x); }
+    }
+  }
+
+  SUBCASE("random access and discard") {
+    const auto reference = engines::philox4x32{0x5EED};
+    auto philox = reference;
+
+    for (unsigned long long n = 0; n < 100; ++n) { CHECK(philox() == reference[n]); }
+
+    for (auto skip : {0ull, 1ull, 3ull, 4ull, 5ull, 1ull << 40, (1ull << 62) + 3}) {
+      auto skipped = engines::philox4x32{0x5EED};
+      skipped.discard(3);
+      skipped.discard(skip);
+      CHECK(skipped() == reference[3 + skip]);
+      CHECK(skipped() == reference[4 + skip]);
+    }
+
+    auto slow = engines::philox4x32{0x5EED};
+    auto fast = slow;
+    for (int i = 0; i < 1001; ++i) { slow(); }
+    fast.discard(1001);
+    CHECK(slow == fast);
+  }
+
+  SUBCASE("bulk generation") {
+    auto philox = engines::philox4x64{0x5EED};
+    auto expected = philox;
+
+    for (auto size : {std::size_t{1}, std::size_t{6}, std::size_t{32}, std::size_t{1001}}) {
+      auto block = std::vector<engines::philox4x64::result_type>(size);
+      philox.generate(block);
+      for (auto x : block) { CHECK(x == expected()); }
+    }
+    CHECK(philox == expected);
+  }
+}
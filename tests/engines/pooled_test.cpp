@@ -0,0 +1,90 @@
+#include "mattsep/random/engines/pooled.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "mattsep/random/distributions/uniform.hpp"
+#include "mattsep/random/engines/jsf.hpp"
+#include "mattsep/random/engines/philox.hpp"
+
+// NOLINTNEXTLINE
+TEST_CASE("mattsep::random::engines::pooled") {
+  using engine_type = mattsep::random::engines::jsf64;
+
+  SUBCASE("bits come from the engine in order") {
+    auto pooled = mattsep::random::engines::pooled<engine_type>{engine_type{0x5EED}};
+    auto engine = engine_type{0x5EED};
+
+    const auto word = engine();
+    for (int i = 0; i < 64; ++i) {
+      CHECK(pooled.entropy<1>() == ((word >> i) & 1u));
+      CHECK(pooled.pooled_bits() == 63 - i);
+    }
+
+    // 24-bit requests straddle word boundaries
+    const auto a = engine();
+    const auto b = engine();
+    const auto c = engine();
+    auto values = std::vector<std::uint64_t>{};
+    for (int i = 0; i < 8; ++i) { values.push_back(pooled.entropy<24>()); }
+    CHECK(values[0] == (a & 0xFF'FFFF));
+    CHECK(values[2] == (((a >> 48) | (b << 16)) & 0xFF'FFFF));
+    CHECK(values[5] == (((b >> 56) | (c << 8)) & 0xFF'FFFF));
+    CHECK(values[7] == (c >> 40));
+    CHECK(pooled.engine() == engine);
+  }
+
+  SUBCASE("generate_entropy draws from the pool") {
+    auto pooled = mattsep::random::engines::pooled<engine_type>{};
+    auto engine = engine_type{};
+
+    auto coin = mattsep::random::distributions::uniform<bool>{};
+    auto heads = 0;
+    for (int i = 0; i < 6400; ++i) { heads += coin(pooled) ? 1 : 0; }
+    engine.discard(100);
+    CHECK(pooled.engine() == engine);
+    CHECK(heads > 3000);
+    CHECK(heads < 3400);
+
+    CHECK(mattsep::random::internal::generate_entropy<64>(pooled) == engine());
+  }
+
+  SUBCASE("peek and consume") {
+    auto pooled = mattsep::random::engines::pooled<engine_type>{};
+    const auto word = engine_type{}();
+
+    CHECK(pooled.peek() == word);
+    CHECK(pooled.pooled_bits() == 64);
+    pooled.consume(5);
+    CHECK(pooled.peek() == (word >> 5));
+    pooled.consume(59);
+    CHECK(pooled.pooled_bits() == 0);
+    auto engine = engine_type{};
+    engine.discard(1);
+    CHECK(pooled.peek() == engine());
+  }
+
+  SUBCASE("raw output bypasses the pool") {
+    auto pooled = mattsep::random::engines::pooled<engine_type>{};
+    auto engine = engine_type{};
+    pooled.entropy<3>();
+    engine();
+    CHECK(pooled() == engine());
+    CHECK(pooled.pooled_bits() == 61);
+
+    pooled.seed(7);
+    CHECK(pooled.pooled_bits() == 0);
+    CHECK(pooled() == engine_type{7}());
+  }
+
+  SUBCASE("discard uses the engine's own") {
+    auto pooled = mattsep::random::engines::pooled<mattsep::random::engines::philox4x64>{};
+    auto engine = mattsep::random::engines::philox4x64{};
+    pooled.discard(1ull << 50);
+    engine.discard(1ull << 50);
+    CHECK(pooled() == engine());
+  }
+}
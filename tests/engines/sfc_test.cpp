@@ -3,8 +3,43 @@
 #include <doctest/doctest.h>
 
 #include <iostream>
+#include <vector>
 
 // NOLINTNEXTLINE
 TEST_CASE("mattsep::random::engines::sfc") {
-  // TODO
-}
\ No newline at end of file
+  SUBCASE("bulk generation") {
+    auto sfc = mattsep::random::engines::sfc64{0x5EED};
+    auto expected = sfc;
+
+    auto block = std::vector<mattsep::random::engines::sfc64::result_type>(1000);
+    sfc.generate(block);
+    for (auto x : block) { CHECK(x == expected()); }
+    CHECK(sfc == expected);
+  }
+
+  SUBCASE("streams") {
+    using engine_type = mattsep::random::engines::sfc64;
+
+    CHECK(engine_type{0x5EED, 0} == engine_type{0x5EED});
+    CHECK(engine_type{0x5EED, 1} != engine_type{0x5EED});
+
+    auto x = engine_type{0x5EED, 1};
+    auto y = engine_type{0x5EED, 2};
+    auto matches = 0;
+    for (int i = 0; i < 1000; ++i) { matches += (x() == y()); }
+    CHECK(matches == 0);
+  }
+
+  SUBCASE("split") {
+    auto parent = mattsep::random::engines::sfc64{0x5EED};
+    auto replay = parent;
+
+    auto child = parent.split();
+    CHECK(child == replay.split());
+    CHECK(parent == replay);
+
+    auto matches = 0;
+    for (int i = 0; i < 1000; ++i) { matches += (parent() == child()); }
+    CHECK(matches == 0);
+  }
+}
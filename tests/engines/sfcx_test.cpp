@@ -0,0 +1,30 @@
+#include "mattsep/random/engines/sfcx.hpp"
+
+#include <doctest/doctest.h>
+
+#include "mattsep/random/engines/sfc.hpp"
+
+#include "lane_checks.hpp"
+
+// NOLINTNEXTLINE
+TEST_CASE("mattsep::random::engines::sfcx") {
+  namespace engines = mattsep::random::engines;
+
+  SUBCASE("32-bit lanes match scalar generation") {
+    lane_checks::check_lanes_match_scalar<engines::sfc32x8, engines::sfc32>();
+    lane_checks::check_lanes_match_scalar<engines::sfc32x16, engines::sfc32>();
+    lane_checks::check_lanes_match_scalar_streams<engines::sfc32x8, engines::sfc32>();
+  }
+
+  SUBCASE("64-bit lanes match scalar generation") {
+    lane_checks::check_lanes_match_scalar<engines::sfc64x4, engines::sfc64>();
+    lane_checks::check_lanes_match_scalar<engines::sfc64x8, engines::sfc64>();
+    lane_checks::check_lanes_match_scalar_streams<engines::sfc64x4, engines::sfc64>();
+  }
+
+  SUBCASE("bulk generation") {
+    lane_checks::check_bulk_matches_scalar_calls<engines::sfc32x8>();
+    lane_checks::check_bulk_matches_scalar_calls<engines::sfc64x4>();
+    lane_checks::check_bulk_matches_scalar_calls<engines::sfc64x8>();
+  }
+}
@@ -0,0 +1,72 @@
+#include "mattsep/random/engines/wyrand.hpp"
+
+#include <doctest/doctest.h>
+
+#include "mattsep/random/concepts.hpp"
+
+#include <cstdint>
+#include <vector>
+
+// NOLINTNEXTLINE
+TEST_CASE("mattsep::random::engines::wyrand") {
+  using engine_type = mattsep::random::engines::wyrand;
+  static_assert(mattsep::random::uniform_random_bit_generator<engine_type>);
+
+  SUBCASE("reference output") {
+    auto wyrand = engine_type{1};
+    for (auto expected : {14839104130206199084ull, 7050053486739369280ull,
+                          10158010531033381599ull, 410858439827017610ull}) {
+      CHECK(wyrand() == expected);
+    }
+  }
+
+  SUBCASE("64-bit generation") {
+    auto wyrand = engine_type{};
+
+    wyrand.seed(1);
+    wyrand.discard((1ull << 20) + 1);
+    CHECK(wyrand() == 17509091320491242716ull);
+
+    wyrand.seed(0x5EED);
+    wyrand.discard((1ull << 20) + 1);
+    CHECK(wyrand() == 15742189657815588419ull);
+
+    wyrand.seed(0xFFFF'FFFF'FFFF'FFFFull);
+    wyrand.discard((1ull << 20) + 1);
+    CHECK(wyrand() == 2376402410057319601ull);
+  }
+
+  SUBCASE("discard") {
+    auto slow = engine_type{0x5EED};
+    auto fast = slow;
+    for (int i = 0; i < 1000; ++i) { slow(); }
+    fast.discard(1000);
+    CHECK(slow == fast);
+  }
+
+  SUBCASE("bulk generation") {
+    auto wyrand = engine_type{0x5EED};
+    auto expected = wyrand;
+
+    auto block = std::vector<engine_type::result_type>(1000);
+    wyrand.generate(block);
+    for (auto x : block) { CHECK(x == expected()); }
+    CHECK(wyrand == expected);
+  }
+
+  SUBCASE("streams and split") {
+    CHECK(engine_type{0x5EED, 0} == engine_type{0x5EED});
+
+    auto x = engine_type{0x5EED, 1};
+    auto y = engine_type{0x5EED, 2};
+    auto matches = 0;
+    for (int i = 0; i < 1000; ++i) { matches += (x() == y()); }
+    CHECK(matches == 0);
+
+    auto parent = engine_type{0x5EED};
+    auto replay = parent;
+    auto child = parent.split();
+    CHECK(child == replay.split());
+    CHECK(parent == replay);
+  }
+}
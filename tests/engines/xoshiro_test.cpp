@@ -0,0 +1,88 @@
+#include "mattsep/random/engines/xoshiro.hpp"
+
+#include <doctest/doctest.h>
+
+#include "mattsep/random/concepts.hpp"
+
+#include <cstdint>
+#include <vector>
+
+// NOLINTNEXTLINE
+TEST_CASE("mattsep::random::engines::xoshiro") {
+  using engine_type = mattsep::random::engines::xoshiro256pp;
+  static_assert(mattsep::random::uniform_random_bit_generator<engine_type>);
+
+  SUBCASE("reference output") {
+    // the reference implementation started from the state {1, 2, 3, 4}
+    auto xoshiro = engine_type::from_state({1, 2, 3, 4});
+    for (auto expected : {41943041ull, 58720359ull, 3588806011781223ull, 3591011842654386ull,
+                          9228616714210784205ull, 9973669472204895162ull, 14011001112246962877ull,
+                          12406186145184390807ull, 15849039046786891736ull,
+                          10450023813501588000ull}) {
+      CHECK(xoshiro() == expected);
+    }
+  }
+
+  SUBCASE("64-bit generation") {
+    auto xoshiro = engine_type{};
+
+    xoshiro.seed(1);
+    xoshiro.discard((1ull << 20) + 1);
+    CHECK(xoshiro() == 9515112254414959379ull);
+
+    xoshiro.seed(0x5EED);
+    xoshiro.discard((1ull << 20) + 1);
+    CHECK(xoshiro() == 3925297052514875534ull);
+
+    xoshiro.seed(0xFFFF'FFFF'FFFF'FFFFull);
+    xoshiro.discard((1ull << 20) + 1);
+    CHECK(xoshiro() == 2757311186112988607ull);
+  }
+
+  SUBCASE("jumps") {
+    // checked against the 2^128-th and 2^192-th powers of the state transition matrix
+    auto xoshiro = engine_type::from_state({1, 2, 3, 4});
+    xoshiro.jump();
+    CHECK(xoshiro.state() == engine_type::state_type{0x8C7A153956B5F3D1, 0x701F1A713401D85E,
+                                                     0x6527F66A65469085, 0x8386B786C4408050});
+
+    xoshiro = engine_type::from_state({1, 2, 3, 4});
+    xoshiro.long_jump();
+    CHECK(xoshiro.state() == engine_type::state_type{0x096A8EB71295A400, 0xDBF84991E50F4516,
+                                                     0x534EE745810D2A0E, 0x31655CA1A2215BF1});
+
+    // a jump commutes with single steps
+    auto stepped = engine_type{0x5EED};
+    auto jumped = stepped;
+    stepped();
+    stepped.jump();
+    jumped.jump();
+    jumped();
+    CHECK(stepped == jumped);
+  }
+
+  SUBCASE("bulk generation") {
+    auto xoshiro = engine_type{0x5EED};
+    auto expected = xoshiro;
+
+    auto block = std::vector<engine_type::result_type>(1000);
+    xoshiro.generate(block);
+    for (auto x : block) { CHECK(x == expected()); }
+    CHECK(xoshiro == expected);
+  }
+
+  SUBCASE("streams and split") {
+    CHECK(engine_type{0x5EED, 0} == engine_type{0x5EED});
+    CHECK(engine_type{0x5EED, 1} != engine_type{0x5EED});
+
+    auto parent = engine_type{0x5EED};
+    auto replay = parent;
+    auto child = parent.split();
+    CHECK(child == replay.split());
+    CHECK(parent == replay);
+
+    auto matches = 0;
+    for (int i = 0; i < 1000; ++i) { matches += (parent() == child()); }
+    CHECK(matches == 0);
+  }
+}
@@ -0,0 +1,47 @@
+#include "mattsep/random/internal/math.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+namespace {
+
+auto ulps(double a, double b) -> double {
+  if (a == b) { return 0.0; }
+  const auto ulp = std::nextafter(std::fabs(b), std::numeric_limits<double>::infinity()) - std::fabs(b);
+  return std::fabs(a - b) / ulp;
+}
+
+}  // namespace
+
+// NOLINTNEXTLINE
+TEST_CASE("mattsep::random::internal::math") {
+  namespace math = mattsep::random::internal::math;
+
+  static_assert(math::exp(0.0) == 1.0);
+  static_assert(math::log(1.0) == 0.0);
+  static_assert(math::sqrt(4.0) == 2.0);
+
+  SUBCASE("agrees with <cmath> to within 2 ulps") {
+    for (auto x = -745.0; x < 709.0; x += 0.0137) { CHECK(ulps(math::exp(x), std::exp(x)) <= 2.0); }
+
+    for (auto e = -1074; e < 1024; ++e) {
+      for (auto m : {1.0, 1.1, 1.4142, 1.5, 1.9999}) {
+        const auto x = std::ldexp(m, e);
+        if (x == 0.0 || !std::isfinite(x)) { continue; }
+        CHECK(ulps(math::log(x), std::log(x)) <= 2.0);
+        CHECK(ulps(math::sqrt(x), std::sqrt(x)) <= 2.0);
+      }
+    }
+  }
+
+  SUBCASE("log_factorial agrees with lgamma") {
+    static_assert(math::log_factorial(0.0) == 0.0);
+    for (auto k = 0.0; k < 100000.0; k = k < 50.0 ? k + 1.0 : k * 1.37) {
+      const auto expected = std::lgamma(k + 1.0);
+      CHECK(std::fabs(math::log_factorial(k) - expected) <= 1e-14 * std::fmax(1.0, expected));
+    }
+  }
+}
@@ -0,0 +1,48 @@
+#include "mattsep/random/parallel.hpp"
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <iostream>
+#include <span>
+#include <vector>
+
+// NOLINTNEXTLINE
+TEST_CASE("mattsep::random::parallel_fill") {
+  namespace random = mattsep::random;
+
+  constexpr auto chunk = random::parallel_fill_chunk_size;
+  constexpr auto size = 3 * chunk + chunk / 2;
+
+  SUBCASE("output is independent of the execution policy") {
+    auto seq = std::vector<std::uint32_t>(size);
+    auto par = std::vector<std::uint32_t>(size);
+    auto par_unseq = std::vector<std::uint32_t>(size);
+
+    random::parallel_fill(std::execution::seq, std::span{seq}, 0x5EED);
+    random::parallel_fill(std::execution::par, std::span{par}, 0x5EED);
+    random::parallel_fill(std::execution::par_unseq, std::span{par_unseq}, 0x5EED);
+
+    CHECK(seq == par);
+    CHECK(seq == par_unseq);
+  }
+
+  SUBCASE("chunk k is generated from stream k") {
+    auto dist = random::distributions::uniform<int>{0, 99};
+    auto values = std::vector<int>(size);
+    random::parallel_fill(std::execution::par, std::span{values}, 42, dist);
+
+    for (std::size_t k = 0; k < 4; ++k) {
+      const auto count = std::min(chunk, size - k * chunk);
+      auto expected = std::vector<int>(count);
+      auto engine = random::default_random_engine{42, k};
+      auto d = dist;
+      d.generate(engine, std::span{expected});
+
+      CHECK(std::equal(expected.begin(), expected.end(), values.begin() + std::ptrdiff_t(k * chunk)));
+    }
+  }
+}
@@ -0,0 +1,77 @@
+#include "mattsep/random/quality.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <iostream>
+
+#include "mattsep/random/engines.hpp"
+
+namespace {
+  // Adjacent outputs differ by a constant, which only a few of the tests can see.
+  struct weyl_sequence {
+    using result_type = std::uint64_t;
+
+    result_type state = 0;
+
+    weyl_sequence(result_type s = 0) : state{s} {}
+
+    auto operator()() -> result_type {
+      return state += 0x9E37'79B9'7F4A'7C15ull;
+    }
+
+    static constexpr auto min() -> result_type {
+      return 0;
+    }
+
+    static constexpr auto max() -> result_type {
+      return ~result_type{0};
+    }
+  };
+}  // namespace
+
+// NOLINTNEXTLINE
+TEST_CASE("mattsep::random::quality") {
+  namespace quality = mattsep::random::quality;
+
+  SUBCASE("p-values") {
+    CHECK(quality::chi_square_p(3.841458820694124, 1) == doctest::Approx(0.05));
+    CHECK(quality::chi_square_p(18.307038053275146, 10) == doctest::Approx(0.05));
+    CHECK(quality::chi_square_p(10.0, 10) == doctest::Approx(0.44049328506521257));
+    CHECK(quality::chi_square_p(0.0, 4) == 1.0);
+    CHECK(quality::normal_p(1.959963984540054) == doctest::Approx(0.05));
+    CHECK(quality::normal_p(0.0) == 1.0);
+
+    CHECK(quality::assess(0.5) == "pass");
+    CHECK(quality::assess(1e-4) == "weak");
+    CHECK(quality::assess(1.0 - 1e-8) == "FAIL");
+  }
+
+  SUBCASE("matrix rank probabilities") {
+    using test = quality::tests::matrix_rank;
+    CHECK(test::probability(64) == doctest::Approx(0.2887880950866).epsilon(1e-9));
+    CHECK(test::probability(63) == doctest::Approx(0.5775761901732).epsilon(1e-9));
+    CHECK(test::probability(62) == doctest::Approx(0.1283502644829).epsilon(1e-9));
+  }
+
+  SUBCASE("good engines pass") {
+    const auto opts = quality::options{std::uint64_t{1} << 19, 2};
+    for (auto const& r : quality::run(mattsep::random::engines::jsf64{}, opts)) {
+      INFO(r.name);
+      CHECK(quality::assess(r.p_value) != "FAIL");
+    }
+    for (auto const& r : quality::run(mattsep::random::engines::sfc32{}, opts)) {
+      INFO(r.name);
+      CHECK(quality::assess(r.p_value) != "FAIL");
+    }
+  }
+
+  SUBCASE("bad engines fail") {
+    const auto opts = quality::options{std::uint64_t{1} << 19, 2};
+    auto failures = 0;
+    for (auto const& r : quality::run(weyl_sequence{}, opts)) {
+      if (quality::assess(r.p_value) == "FAIL") { ++failures; }
+    }
+    CHECK(failures > 0);
+  }
+}
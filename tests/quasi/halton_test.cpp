@@ -0,0 +1,98 @@
+#include "mattsep/random/quasi/halton.hpp"
+
+#include <doctest/doctest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+  namespace quasi = mattsep::random::quasi;
+
+  auto points(quasi::halton& halton, std::size_t count) -> std::vector<std::vector<double>> {
+    auto out = std::vector<std::vector<double>>(count, std::vector<double>(halton.dimensions()));
+    for (auto& p : out) { halton.next(p); }
+    return out;
+  }
+
+  // The radical inverse of n in base b, digit by digit.
+  auto radical_inverse(std::uint64_t n, std::uint32_t b) -> double {
+    auto x = 0.0;
+    auto scale = 1.0 / b;
+    for (; n != 0; n /= b, scale /= b) { x += static_cast<double>(n % b) * scale; }
+    return x;
+  }
+}  // namespace
+
+// NOLINTNEXTLINE
+TEST_CASE("mattsep::random::quasi::halton") {
+  SUBCASE("bases are the primes") {
+    auto halton = quasi::halton{10};
+    auto bases = std::vector<std::uint32_t>{};
+    for (std::size_t j = 0; j < halton.dimensions(); ++j) { bases.push_back(halton.base(j)); }
+    CHECK((bases == std::vector<std::uint32_t>{2, 3, 5, 7, 11, 13, 17, 19, 23, 29}));
+    CHECK(quasi::halton{1000}.base(999) == 7919);
+  }
+
+  SUBCASE("first points") {
+    auto halton = quasi::halton{3};
+    const auto expected = std::vector<std::array<double, 3>>{
+        {0.0, 0.0, 0.0},           {1.0 / 2, 1.0 / 3, 1.0 / 5}, {1.0 / 4, 2.0 / 3, 2.0 / 5},
+        {3.0 / 4, 1.0 / 9, 3.0 / 5}, {1.0 / 8, 4.0 / 9, 4.0 / 5}, {5.0 / 8, 7.0 / 9, 1.0 / 25}};
+    for (auto const& e : expected) {
+      const auto p = points(halton, 1)[0];
+      for (std::size_t j = 0; j < 3; ++j) { CHECK(p[j] == doctest::Approx(e[j]).epsilon(1e-15)); }
+    }
+  }
+
+  SUBCASE("seek matches stepping") {
+    auto stepped = quasi::halton{50};
+    points(stepped, 12345);
+    auto sought = quasi::halton{50};
+    sought.seek(12345);
+    CHECK(sought.index() == 12345);
+    CHECK((points(sought, 100) == points(stepped, 100)));
+
+    for (auto index : {(1ull << 40) + 12345, ~0ull - 3}) {
+      auto halton = quasi::halton{1000};
+      halton.seek(index);
+      const auto p = points(halton, 1)[0];
+      for (std::size_t j : {0u, 1u, 17u, 999u}) {
+        CHECK(p[j] == doctest::Approx(radical_inverse(index, halton.base(j))).epsilon(1e-14));
+      }
+      CHECK(p[0] < 1.0);
+    }
+  }
+
+  SUBCASE("batches are structure of arrays") {
+    auto single = quasi::halton{7};
+    auto batched = quasi::halton{7};
+    single.seek(1000);
+    batched.discard(1000);
+
+    auto out = std::vector<double>(7 * 200);
+    batched.generate(out);
+    CHECK(batched.index() == 1200);
+
+    const auto expected = points(single, 200);
+    auto same = true;
+    for (std::size_t i = 0; i < 200; ++i) {
+      for (std::size_t j = 0; j < 7; ++j) { same = same && out[j * 200 + i] == expected[i][j]; }
+    }
+    CHECK(same);
+    CHECK((points(single, 5) == points(batched, 5)));
+  }
+
+  SUBCASE("invalid arguments") {
+    CHECK_THROWS_AS(quasi::halton{0}, std::invalid_argument);
+
+    auto halton = quasi::halton{3};
+    auto point = std::array<double, 4>{};
+    CHECK_THROWS_AS(halton.next(point), std::invalid_argument);
+    auto out = std::vector<double>(8);
+    CHECK_THROWS_AS(halton.generate(out), std::invalid_argument);
+  }
+}
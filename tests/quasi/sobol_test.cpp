@@ -0,0 +1,215 @@
+#include "mattsep/random/quasi/sobol.hpp"
+
+#include <doctest/doctest.h>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "mattsep/random/engines.hpp"
+
+namespace {
+  namespace quasi = mattsep::random::quasi;
+
+  // Takes the next `count` points, point by point.
+  auto points(quasi::sobol& sobol, std::size_t count) -> std::vector<std::vector<double>> {
+    auto out = std::vector<std::vector<double>>(count, std::vector<double>(sobol.dimensions()));
+    for (auto& p : out) { sobol.next(p); }
+    return out;
+  }
+
+  // Each of the 2^m points starting at a multiple of 2^m is alone in its interval of length 2^-m.
+  auto stratified(std::vector<std::vector<double>> const& pts, std::size_t j, int m) -> bool {
+    auto cells = std::set<std::uint64_t>{};
+    for (auto const& p : pts) { cells.insert(static_cast<std::uint64_t>(std::ldexp(p[j], m))); }
+    return cells.size() == pts.size() && *cells.rbegin() < (1ull << m);
+  }
+
+  // The first two dimensions form a (0, m, 2)-net: every box 2^-k by 2^-(m-k) holds one point.
+  auto is_net(std::vector<std::vector<double>> const& pts, int m) -> bool {
+    for (int k = 0; k <= m; ++k) {
+      auto cells = std::set<std::uint64_t>{};
+      for (auto const& p : pts) {
+        const auto x = static_cast<std::uint64_t>(std::ldexp(p[0], k));
+        const auto y = static_cast<std::uint64_t>(std::ldexp(p[1], m - k));
+        cells.insert((x << (m - k)) + y);
+      }
+      if (cells.size() != pts.size()) { return false; }
+    }
+    return true;
+  }
+}  // namespace
+
+// NOLINTNEXTLINE
+TEST_CASE("mattsep::random::quasi::sobol") {
+  SUBCASE("first points") {
+    auto sobol = quasi::sobol{3};
+    const auto expected = std::vector<std::vector<double>>{
+        {0.0, 0.0, 0.0},       {0.5, 0.5, 0.5},       {0.75, 0.25, 0.25},
+        {0.25, 0.75, 0.75},    {0.375, 0.375, 0.625}, {0.875, 0.875, 0.125},
+        {0.625, 0.125, 0.875}, {0.125, 0.625, 0.375}};
+    CHECK((points(sobol, expected.size()) == expected));
+    CHECK(sobol.index() == expected.size());
+  }
+
+  SUBCASE("the last dimension of the built-in table") {
+    auto sobol = quasi::sobol{quasi::sobol::max_dimensions};
+    CHECK(quasi::sobol::max_dimensions == 3667);
+    for (auto expected : {0.0, 0.5, 0.25, 0.75, 0.625, 0.125, 0.875, 0.375, 0.8125}) {
+      CHECK(points(sobol, 1)[0].back() == expected);
+    }
+  }
+
+  SUBCASE("direction numbers read from a file") {
+    auto file = std::istringstream{
+        "d       s       a       m_i\n"
+        "2       1       0       1\n"
+        "3       2       1       1 3\n"
+        "4       3       1       1 3 1\n"
+        "5       3       2       1 1 1\n"
+        "6       4       1       1 1 3 3\n"
+        "7       4       4       1 3 5 13\n"
+        "8       5       2       1 1 5 5 17\n"};
+    const auto parameters = quasi::read_joe_kuo(file);
+    REQUIRE(parameters.size() == 7);
+    CHECK((parameters[5] == quasi::sobol_parameters{4, 4, {1, 3, 5, 13}}));
+
+    auto from_file = quasi::sobol{8, parameters};
+    auto built_in = quasi::sobol{8};
+    CHECK((points(from_file, 1000) == points(built_in, 1000)));
+
+    CHECK_THROWS_AS(quasi::sobol(9, parameters), std::invalid_argument);
+    for (auto bad : {"2 1 0\n", "2 1 0 1 5\n", "3 1 0 1\n", "2 2 1 1 5\n", "2 2 2 1 3\n",
+                     "2 x 0 1\n"}) {
+      auto in = std::istringstream{bad};
+      CHECK_THROWS_AS(quasi::read_joe_kuo(in), std::invalid_argument);
+    }
+  }
+
+  SUBCASE("seek matches stepping") {
+    for (auto index : {0ull, 1ull, 5ull, 1000ull}) {
+      auto stepped = quasi::sobol{20};
+      points(stepped, static_cast<std::size_t>(index));
+      const auto expected = points(stepped, 10);
+
+      auto sought = quasi::sobol{20};
+      sought.seek(index);
+      CHECK(sought.index() == index);
+      CHECK((points(sought, 10) == expected));
+
+      auto discarded = quasi::sobol{20};
+      discarded.discard(index);
+      CHECK((points(discarded, 10) == expected));
+    }
+
+    for (auto index : {(1ull << 40) + 3, (1ull << 63) - 2}) {
+      auto sought = quasi::sobol{20};
+      sought.seek(index);
+      points(sought, 1);
+      auto next = quasi::sobol{20};
+      next.seek(index + 1);
+      CHECK((points(sought, 3) == points(next, 3)));
+    }
+
+    // After the last index the sequence starts again from the origin.
+    auto last = quasi::sobol{20};
+    last.seek(~0ull);
+    points(last, 1);
+    CHECK(last.index() == 0);
+    CHECK((points(last, 1)[0] == std::vector<double>(20)));
+  }
+
+  SUBCASE("batches are structure of arrays") {
+    auto engine = mattsep::random::engines::jsf64{7};
+    for (auto scrambled : {false, true}) {
+      auto single = quasi::sobol{5};
+      auto batched = quasi::sobol{5};
+      if (scrambled) {
+        single.scramble(engine);
+        batched = single;
+      }
+      single.seek(100);
+      batched.seek(100);
+
+      auto out = std::vector<double>(5 * 300);
+      batched.generate(std::span{out}.first(5 * 37));
+      batched.generate(std::span{out}.subspan(5 * 37));
+      CHECK(batched.index() == 400);
+
+      const auto expected = points(single, 300);
+      auto same = true;
+      for (std::size_t i = 0; i < 37; ++i) {
+        for (std::size_t j = 0; j < 5; ++j) { same = same && out[j * 37 + i] == expected[i][j]; }
+      }
+      for (std::size_t i = 37; i < 300; ++i) {
+        for (std::size_t j = 0; j < 5; ++j) {
+          same = same && out[5 * 37 + j * 263 + (i - 37)] == expected[i][j];
+        }
+      }
+      CHECK(same);
+    }
+  }
+
+  SUBCASE("stratification survives scrambling") {
+    auto engine = mattsep::random::engines::jsf64{42};
+    auto plain = quasi::sobol{40};
+    auto scrambled = plain;
+    scrambled.scramble(engine);
+    CHECK(scrambled.scrambled());
+
+    constexpr auto m = 10;
+    for (auto start : {0ull, 5ull << m}) {
+      plain.seek(start);
+      scrambled.seek(start);
+      const auto a = points(plain, 1 << m);
+      const auto b = points(scrambled, 1 << m);
+      CHECK(a != b);
+      CHECK(is_net(a, m));
+      CHECK(is_net(b, m));
+      for (std::size_t j = 0; j < 40; ++j) {
+        CHECK(stratified(a, j, m));
+        CHECK(stratified(b, j, m));
+      }
+    }
+
+    auto other = quasi::sobol{40};
+    other.scramble(engine);
+    CHECK(points(other, 4) != points(scrambled, 4));
+  }
+
+  SUBCASE("scrambled integration") {
+    // Each factor 2 x integrates to 1 over [0, 1). Independent uniform points would be off by
+    // about 0.017 at this size.
+    auto engine = mattsep::random::engines::sfc64{1};
+    auto sobol = quasi::sobol{6};
+    sobol.scramble(engine);
+    constexpr auto n = std::size_t{1} << 14;
+    auto out = std::vector<double>(6 * n);
+    sobol.generate(out);
+
+    auto sum = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+      auto f = 1.0;
+      for (std::size_t j = 0; j < 6; ++j) { f *= 2.0 * out[j * n + i]; }
+      sum += f;
+    }
+    CHECK(sum / static_cast<double>(n) == doctest::Approx(1.0).epsilon(1e-3));
+  }
+
+  SUBCASE("invalid arguments") {
+    CHECK_THROWS_AS(quasi::sobol{0}, std::invalid_argument);
+    CHECK_THROWS_AS(quasi::sobol{quasi::sobol::max_dimensions + 1}, std::invalid_argument);
+
+    auto sobol = quasi::sobol{3};
+    auto point = std::array<double, 2>{};
+    CHECK_THROWS_AS(sobol.next(point), std::invalid_argument);
+    auto out = std::vector<double>(7);
+    CHECK_THROWS_AS(sobol.generate(out), std::invalid_argument);
+  }
+}
@@ -2,9 +2,43 @@
 
 #include <doctest/doctest.h>
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <iostream>
+#include <span>
+#include <vector>
 
 // NOLINTNEXTLINE
 TEST_CASE("mattsep::random::rng") {
-  // TODO
-}
\ No newline at end of file
+  SUBCASE("bulk fill") {
+    auto rng = mattsep::random::rng{};
+
+    auto ints = std::vector<int>(1000);
+    rng.fill(std::span{ints}, -3, 3);
+    CHECK(std::all_of(ints.begin(), ints.end(), [](int x) { return -3 <= x && x <= 3; }));
+    CHECK(std::count(ints.begin(), ints.end(), -3) > 0);
+    CHECK(std::count(ints.begin(), ints.end(), 3) > 0);
+
+    auto reals = std::vector<double>(1000);
+    rng.fill(std::span{reals});
+    CHECK(std::all_of(reals.begin(), reals.end(), [](double x) { return 0.0 <= x && x < 1.0; }));
+  }
+
+  SUBCASE("byte fill") {
+    using engine_type = mattsep::random::default_random_engine;
+
+    for (auto size : {std::size_t{0}, std::size_t{3}, std::size_t{64}, std::size_t{1001}}) {
+      auto rng = mattsep::random::rng{};
+      auto bytes = std::vector<std::byte>(size);
+      rng.fill_bytes(bytes);
+
+      auto engine = engine_type{};
+      auto words =
+          std::vector<engine_type::result_type>(size / sizeof(engine_type::result_type) + 1);
+      engine.generate(words);
+
+      CHECK(std::equal(bytes.begin(), bytes.end(), std::as_bytes(std::span{words}).begin()));
+    }
+  }
+}
@@ -0,0 +1,112 @@
+#include "mattsep/random/seeding.hpp"
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <span>
+#include <vector>
+
+#include "mattsep/random/engines.hpp"
+
+namespace {
+  namespace random = mattsep::random;
+
+  template <class Engine>
+  auto first_output(std::span<typename Engine::result_type const> material) {
+    auto engine = Engine{material};
+    return engine();
+  }
+
+  // Seeds engines from the consecutive material {i} and counts the set bits of their first outputs,
+  // which should be as balanced as random words without any warm-up.
+  template <class Engine>
+  auto check_no_warm_up() -> void {
+    using result_type = typename Engine::result_type;
+    constexpr int engines = 4096;
+    constexpr auto bits = std::numeric_limits<result_type>::digits;
+
+    auto ones = 0;
+    for (int i = 0; i < engines; ++i) {
+      const auto material = std::array{static_cast<result_type>(i)};
+      ones += std::popcount(first_output<Engine>(material));
+    }
+    const auto expected = engines * bits / 2;
+    CHECK(std::abs(ones - expected) < 5 * 0.5 * std::sqrt(engines * bits));
+  }
+}  // namespace
+
+// NOLINTNEXTLINE
+TEST_CASE("mattsep::random::seeding") {
+  static_assert(random::material_seedable<random::engines::jsf64>);
+  static_assert(random::material_seedable<random::engines::sfc32>);
+  static_assert(random::material_seedable<random::engines::philox4x64>);
+  static_assert(random::material_seedable<random::engines::pooled<random::engines::sfc64>>);
+
+  SUBCASE("material of any length") {
+    using engine_type = random::engines::sfc64;
+    auto outputs = std::set<std::uint64_t>{};
+    const auto empty = std::array<std::uint64_t, 0>{};
+    const auto zero = std::array<std::uint64_t, 1>{0};
+    const auto zeros = std::array<std::uint64_t, 2>{0, 0};
+    const auto long_material = std::array<std::uint64_t, 6>{1, 2, 3, 4, 5, 6};
+    outputs.insert(first_output<engine_type>(empty));
+    outputs.insert(first_output<engine_type>(zero));
+    outputs.insert(first_output<engine_type>(zeros));
+    outputs.insert(first_output<engine_type>(long_material));
+    CHECK(outputs.size() == 4);
+
+    CHECK(engine_type{long_material} == engine_type{long_material});
+    auto reseeded = engine_type{};
+    reseeded.seed(long_material);
+    CHECK(reseeded == engine_type{long_material});
+  }
+
+  SUBCASE("no warm-up is needed") {
+    check_no_warm_up<random::engines::jsf32>();
+    check_no_warm_up<random::engines::jsf64>();
+    check_no_warm_up<random::engines::sfc32>();
+    check_no_warm_up<random::engines::sfc64>();
+    check_no_warm_up<random::engines::philox4x32>();
+    check_no_warm_up<random::engines::xoshiro256pp>();
+    check_no_warm_up<random::engines::pcg64_dxsm>();
+    check_no_warm_up<random::engines::wyrand>();
+    check_no_warm_up<random::engines::romu_trio>();
+  }
+
+  SUBCASE("seed_many") {
+    auto engines = std::vector<random::engines::jsf32>(100);
+    random::seed_many(std::span{engines}, 12345);
+    for (std::uint32_t i = 0; i < engines.size(); ++i) {
+      const auto material = std::array<std::uint32_t, 4>{12345, 0, i, 0};
+      CHECK(engines[i] == random::engines::jsf32{material});
+    }
+
+    auto wide = std::vector<random::engines::sfc64>(100);
+    const auto material = std::array<std::uint64_t, 2>{7, 8};
+    random::seed_many(std::span{wide}, std::span<std::uint64_t const>{material});
+    const auto expected = std::array<std::uint64_t, 3>{7, 8, 42};
+    CHECK(wide[42] == random::engines::sfc64{expected});
+
+    auto pooled = std::vector<random::engines::pooled<random::engines::philox4x64>>(100);
+    random::seed_many(std::span{pooled}, std::span<std::uint64_t const>{material});
+    auto engine = random::engines::philox4x64{expected};
+    CHECK(pooled[42]() == engine());
+  }
+
+  SUBCASE("operating system entropy") {
+    auto bytes = std::array<std::byte, 64>{};
+    random::os_entropy(bytes);
+    CHECK(std::count(bytes.begin(), bytes.end(), std::byte{0}) < 16);
+
+    auto engines = std::vector<random::engines::sfc64>(1000);
+    random::seed_many(std::span{engines});
+    auto outputs = std::set<std::uint64_t>{};
+    for (auto& e : engines) { outputs.insert(e()); }
+    CHECK(outputs.size() == engines.size());
+  }
+}
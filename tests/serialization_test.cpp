@@ -0,0 +1,107 @@
+#include "mattsep/random/serialization.hpp"
+
+#include <doctest/doctest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "mattsep/random/engines.hpp"
+#include "mattsep/random/rng.hpp"
+
+namespace {
+  namespace random = mattsep::random;
+
+  // Restores an engine part way through its stream and checks that it carries on identically.
+  template <class Engine>
+  auto check_round_trip(Engine engine) -> void {
+    for (int i = 0; i < 3; ++i) { engine(); }
+
+    auto copy = Engine::from_state(engine.state());
+    CHECK(copy == engine);
+    for (int i = 0; i < 100; ++i) { CHECK(copy() == engine()); }
+
+    auto bytes = std::array<std::byte, random::state_bytes<Engine>>{};
+    CHECK(random::save_state(engine, bytes).empty());
+    auto loaded = random::load_state<Engine>(bytes);
+    CHECK(loaded == engine);
+    CHECK(loaded() == engine());
+  }
+}  // namespace
+
+// NOLINTNEXTLINE
+TEST_CASE("mattsep::random::serialization") {
+  SUBCASE("every engine round trips") {
+    using background = random::engines::background<random::engines::jsf64>;
+    static_assert(!random::restorable_random_bit_generator<background>);
+
+    check_round_trip(random::engines::jsf32{});
+    check_round_trip(random::engines::jsf64{});
+    check_round_trip(random::engines::sfc32{});
+    check_round_trip(random::engines::sfc64{});
+    check_round_trip(random::engines::jsf64x4{});
+    check_round_trip(random::engines::sfc32x8{});
+    check_round_trip(random::engines::philox4x32{});
+    check_round_trip(random::engines::philox4x64{5, 7});
+    check_round_trip(random::engines::xoshiro256pp{});
+    check_round_trip(random::engines::pcg64_dxsm{5, 7});
+    check_round_trip(random::engines::wyrand{});
+    check_round_trip(random::engines::romu_trio{});
+    check_round_trip(random::engines::chacha20{});
+    check_round_trip(random::engines::pooled<random::engines::jsf32>{});
+
+    auto pooled = random::engines::pooled<random::engines::sfc64>{};
+    pooled.entropy<5>();
+    check_round_trip(pooled);
+  }
+
+  SUBCASE("rng") {
+    auto rng = random::rng{};
+    rng.random<int>();
+    auto copy = random::rng<>::from_state(rng.state());
+    CHECK(copy.random<std::uint64_t>() == rng.random<std::uint64_t>());
+  }
+
+  SUBCASE("the encoding is little-endian") {
+    auto engine = random::engines::jsf32{};
+    const auto state = engine.state();
+    auto bytes = std::array<std::byte, 16>{};
+    random::save_state(engine, bytes);
+    for (std::size_t i = 0; i < 4; ++i) {
+      for (std::size_t j = 0; j < 4; ++j) {
+        CHECK(bytes[4 * i + j] == static_cast<std::byte>(state[i] >> (8 * j)));
+      }
+    }
+  }
+
+  SUBCASE("arrays of engines") {
+    auto engines = std::vector<random::engines::sfc64>{};
+    for (std::uint64_t i = 0; i < 1000; ++i) { engines.emplace_back(i, i); }
+
+    constexpr auto bytes = random::state_bytes<random::engines::sfc64>;
+    auto buffer = std::vector<std::byte>(engines.size() * bytes + 3);
+    const auto rest = random::save_states(engines, buffer);
+    CHECK(rest.size() == 3);
+
+    auto restored = std::vector<random::engines::sfc64>(engines.size());
+    const auto unread = random::load_states(std::span<std::byte const>{buffer}, restored);
+    CHECK(unread.size() == 3);
+    CHECK(restored == engines);
+
+    const auto whole = std::span<std::byte const>{buffer}.first(buffer.size() - 3);
+    CHECK(random::load_states<random::engines::sfc64>(whole) == engines);
+  }
+
+  SUBCASE("short buffers are rejected") {
+    auto engines = std::vector<random::engines::jsf64>(4);
+    auto buffer = std::vector<std::byte>(3 * random::state_bytes<random::engines::jsf64>);
+    CHECK_THROWS_AS(random::save_states(engines, buffer), std::length_error);
+    CHECK_THROWS_AS(random::load_states(std::span<std::byte const>{buffer}, engines),
+                    std::length_error);
+    CHECK_THROWS_AS(random::load_states<random::engines::jsf64>(
+                        std::span<std::byte const>{buffer}.first(10)),
+                    std::length_error);
+  }
+}
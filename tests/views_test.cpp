@@ -0,0 +1,88 @@
+#include "mattsep/random/views.hpp"
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <vector>
+
+#include "mattsep/random/distributions.hpp"
+#include "mattsep/random/engines.hpp"
+#include "mattsep/random/rng.hpp"
+
+// NOLINTNEXTLINE
+TEST_CASE("mattsep::random::view") {
+  namespace random = mattsep::random;
+
+  using view_type = random::random_view<random::engines::jsf64, random::distributions::normal<>>;
+  static_assert(std::ranges::input_range<view_type>);
+  static_assert(std::ranges::view<view_type>);
+  static_assert(!std::ranges::sized_range<view_type>);
+
+  SUBCASE("values match a bulk fill") {
+    auto engine = random::engines::jsf64{};
+    auto expected_engine = engine;
+    auto dist = random::distributions::normal<double>{};
+
+    constexpr auto block_size = view_type::block_size;
+    auto expected = std::vector<double>(2 * block_size + 44);
+    auto expected_dist = dist;
+    for (std::size_t i = 0; i < expected.size(); i += block_size) {
+      const auto n = std::min(block_size, expected.size() - i);
+      auto block = std::vector<double>(block_size);
+      expected_dist.generate(expected_engine, block);
+      std::copy_n(block.begin(), n, expected.begin() + static_cast<std::ptrdiff_t>(i));
+    }
+
+    auto values = std::vector<double>{};
+    std::ranges::copy(random::view(engine, dist) | std::views::take(expected.size()),
+                      std::back_inserter(values));
+    CHECK(values == expected);
+    CHECK(engine == expected_engine);
+  }
+
+  SUBCASE("blocks are drawn only when read") {
+    auto engine = random::engines::sfc64{};
+    auto before = engine;
+    auto v = random::view(engine, random::distributions::uniform<std::uint64_t>{});
+    auto it = v.begin();
+    CHECK(engine == before);
+
+    const auto first = *it;
+    CHECK(*it == first);
+    CHECK(first == before());
+    constexpr auto block_size = decltype(v)::block_size;
+    for (std::size_t i = 0; i + 1 < block_size; ++i) { ++it; }
+    before.discard(block_size - 1);
+    CHECK(engine == before);
+    ++it;
+    CHECK(engine == before);
+    CHECK(*it == before());
+  }
+
+  SUBCASE("rng views and range algorithms") {
+    auto rng = random::rng{};
+    auto rolls = rng.view<int>(1, 6) | std::views::take(6000);
+    auto counts = std::vector<int>(7);
+    for (auto x : rolls) {
+      REQUIRE(x >= 1);
+      REQUIRE(x <= 6);
+      ++counts[static_cast<std::size_t>(x)];
+    }
+    for (int face = 1; face <= 6; ++face) {
+      CHECK(counts[static_cast<std::size_t>(face)] > 850);
+      CHECK(counts[static_cast<std::size_t>(face)] < 1150);
+    }
+
+    auto small = rng.view<double>() | std::views::filter([](double x) { return x < 0.25; }) |
+                 std::views::take(100);
+    CHECK(std::ranges::all_of(small, [](double x) { return x < 0.25; }));
+
+    auto coins = rng.view<random::distributions::bernoulli>(0.5) | std::views::take(1000);
+    const auto heads = std::ranges::count(coins, true);
+    CHECK(heads > 400);
+    CHECK(heads < 600);
+  }
+}
@@ -0,0 +1,187 @@
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include "mattsep/random/engines.hpp"
+#include "mattsep/random/internal.hpp"
+#include "mattsep/random/quality.hpp"
+
+namespace {
+  namespace random = mattsep::random;
+
+  constexpr auto usage = R"(usage: mattsep-random-quality [options]
+
+Runs a battery of statistical tests on an engine, or streams its raw output.
+
+options:
+  --engine NAME   the engine to use (default: jsf64); one of
+                  jsf32 jsf64 sfc32 sfc64 jsf32x8 jsf32x16 jsf64x4 jsf64x8
+                  sfc32x8 sfc32x16 sfc64x4 sfc64x8 philox4x32 philox4x64
+                  xoshiro256pp pcg64_dxsm wyrand romu_trio chacha8 chacha12 chacha20
+                  mt19937_64
+  --seed N        the seed (default: the engine's default seed)
+  --words N       64-bit words per test, across all threads (default: 2^24)
+  --threads N     worker threads (default: all hardware threads)
+  --stream        write raw engine output to stdout instead of testing,
+                  e.g. for `mattsep-random-quality --stream | RNG_test stdin64`
+  --bytes N       with --stream, stop after N bytes (default: never)
+  --help          show this message
+)";
+
+  struct arguments {
+    std::string_view engine = "jsf64";
+    std::uint64_t seed = 0;
+    bool seeded = false;
+    random::quality::options options = {};
+    bool stream = false;
+    std::uint64_t bytes = 0;
+  };
+
+  /**
+   * @brief Parses a decimal count, optionally written as a power of two, e.g. `2^30`.
+   */
+  auto parse_count(std::string_view text, std::uint64_t& value) -> bool {
+    auto const* first = text.data();
+    auto const* last = text.data() + text.size();
+    auto const power = text.starts_with("2^");
+    if (power) { first += 2; }
+
+    auto const [end, ec] = std::from_chars(first, last, value);
+    if (ec != std::errc{} || end != last) { return false; }
+    if (power) {
+      if (value >= 64) { return false; }
+      value = std::uint64_t{1} << value;
+    }
+    return true;
+  }
+
+  auto parse(std::span<char*> args, arguments& out) -> bool {
+    for (std::size_t i = 0; i < args.size(); ++i) {
+      const auto arg = std::string_view{args[i]};
+      const auto next = [&]() -> std::string_view {
+        return i + 1 < args.size() ? std::string_view{args[++i]} : std::string_view{};
+      };
+
+      auto count = std::uint64_t{0};
+      if (arg == "--engine") {
+        out.engine = next();
+      } else if (arg == "--seed" && parse_count(next(), count)) {
+        out.seed = count;
+        out.seeded = true;
+      } else if (arg == "--words" && parse_count(next(), count) && count > 0) {
+        out.options.words = count;
+      } else if (arg == "--threads" && parse_count(next(), count)) {
+        out.options.threads = static_cast<unsigned>(count);
+      } else if (arg == "--bytes" && parse_count(next(), count)) {
+        out.bytes = count;
+      } else if (arg == "--stream") {
+        out.stream = true;
+      } else {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Writes the engine's output to stdout until @a bytes have been written (0 for no limit)
+   * or the reader goes away.
+   */
+  template <class Engine>
+  auto stream(Engine& engine, std::uint64_t bytes) -> int {
+    std::setvbuf(stdout, nullptr, _IONBF, 0);
+
+    auto buffer = std::vector<std::byte>(std::size_t{1} << 20);
+    for (auto unlimited = bytes == 0; unlimited || bytes > 0;) {
+      auto n = buffer.size();
+      if (!unlimited && bytes < n) { n = static_cast<std::size_t>(bytes); }
+
+      const auto out = std::span{buffer}.first(n);
+      random::internal::fill_bytes(engine, out);
+      if (std::fwrite(out.data(), 1, n, stdout) != n) { return 0; }
+      if (!unlimited) { bytes -= n; }
+    }
+    return 0;
+  }
+
+  auto report(std::vector<random::quality::result> const& results) -> int {
+    auto failed = false;
+    std::cout << std::left << std::setw(32) << "test" << std::right << std::setw(14) << "statistic"
+              << std::setw(14) << "p-value" << "  assessment\n";
+    for (auto const& r : results) {
+      const auto verdict = random::quality::assess(r.p_value);
+      failed = failed || verdict == "FAIL";
+      std::cout << std::left << std::setw(32) << r.name << std::right << std::setw(14)
+                << std::setprecision(6) << r.statistic << std::setw(14) << r.p_value << "  "
+                << verdict << '\n';
+    }
+    return failed ? 1 : 0;
+  }
+
+  template <class Engine>
+  auto run(arguments const& args) -> int {
+    using result_type = typename Engine::result_type;
+    auto engine = args.seeded ? Engine{static_cast<result_type>(args.seed)} : Engine{};
+
+    if (args.stream) { return stream(engine, args.bytes); }
+
+    std::cout << "engine: " << args.engine << ", words per test: " << args.options.words << "\n\n";
+    return report(random::quality::run(engine, args.options));
+  }
+
+  auto dispatch(arguments const& args) -> int {
+    namespace engines = random::engines;
+
+    const auto& name = args.engine;
+    if (name == "jsf32") { return run<engines::jsf32>(args); }
+    if (name == "jsf64") { return run<engines::jsf64>(args); }
+    if (name == "sfc32") { return run<engines::sfc32>(args); }
+    if (name == "sfc64") { return run<engines::sfc64>(args); }
+    if (name == "jsf32x8") { return run<engines::jsf32x8>(args); }
+    if (name == "jsf32x16") { return run<engines::jsf32x16>(args); }
+    if (name == "jsf64x4") { return run<engines::jsf64x4>(args); }
+    if (name == "jsf64x8") { return run<engines::jsf64x8>(args); }
+    if (name == "sfc32x8") { return run<engines::sfc32x8>(args); }
+    if (name == "sfc32x16") { return run<engines::sfc32x16>(args); }
+    if (name == "sfc64x4") { return run<engines::sfc64x4>(args); }
+    if (name == "sfc64x8") { return run<engines::sfc64x8>(args); }
+    if (name == "philox4x32") { return run<engines::philox4x32>(args); }
+    if (name == "philox4x64") { return run<engines::philox4x64>(args); }
+    if (name == "xoshiro256pp") { return run<engines::xoshiro256pp>(args); }
+    if (name == "pcg64_dxsm") { return run<engines::pcg64_dxsm>(args); }
+    if (name == "wyrand") { return run<engines::wyrand>(args); }
+    if (name == "romu_trio") { return run<engines::romu_trio>(args); }
+    if (name == "chacha8") { return run<engines::chacha8>(args); }
+    if (name == "chacha12") { return run<engines::chacha12>(args); }
+    if (name == "chacha20") { return run<engines::chacha20>(args); }
+    if (name == "mt19937_64") { return run<std::mt19937_64>(args); }
+
+    std::cerr << "unknown engine: " << name << '\n';
+    return 2;
+  }
+}  // namespace
+
+auto main(int argc, char** argv) -> int {
+  auto args = arguments{};
+  const auto rest = std::span{argv, static_cast<std::size_t>(argc)}.subspan(1);
+  for (auto const* arg : rest) {
+    if (std::strcmp(arg, "--help") == 0) {
+      std::cout << usage;
+      return 0;
+    }
+  }
+  if (!parse(rest, args)) {
+    std::cerr << usage;
+    return 2;
+  }
+  return dispatch(args);
+}